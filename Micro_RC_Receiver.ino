@@ -8,7 +8,7 @@
 
 // * * * * N O T E ! The vehicle specific configurations are stored in "vehicleConfig.h" * * * *
 
-const float codeVersion = 3.9; // Software revision (see https://github.com/TheDIYGuy999/Micro_RC_Receiver/blob/master/README.md)
+const float codeVersion = 4.0; // Software revision (see https://github.com/TheDIYGuy999/Micro_RC_Receiver/blob/master/README.md)
 
 //
 // =======================================================================================================
@@ -18,6 +18,19 @@ const float codeVersion = 3.9; // Software revision (see https://github.com/TheD
 
 //#define DEBUG // if not commented out, Serial.print() is active! For debugging only!!
 
+//#define RADIO_IRQ_PIN 2 // if not commented out, packets are received in the NRF24 IRQ pin interrupt (pin 2 or 3 only, not wired on the standard board!)
+//#define MOTOR2_IN2_PIN 10 // if not commented out, motor 2 IN2 is re-wired from pin 2 to this pin (frees pin 2 for RADIO_IRQ_PIN)
+
+//#define STAGE_TIMING // if not commented out, the time of each loop() stage is measured and printed in DEBUG mode
+
+//#define PROFILER // if not commented out, the code regions in profiler.h are measured and printed in DEBUG mode
+
+//#define COMPACT_TELEMETRY // if not commented out, the ACK payload uses the compact telemetry frame (transmitter support required!)
+
+//#define MPU6050_FIFO // if not commented out, the MPU-6050 samples are buffered in its FIFO and read in bursts
+
+//#define LATENCY_TIMING // if not commented out, the delay between packet reception and output is measured and printed in DEBUG mode
+
 //
 // =======================================================================================================
 // INCLUDE LIRBARIES
@@ -25,24 +38,34 @@ const float codeVersion = 3.9; // Software revision (see https://github.com/TheD
 //
 
 // Libraries
-#include <Wire.h> // I2C library (for the MPU-6050 gyro /accelerometer)
 #include <RF24.h> // Installed via Sketch > Include Library > Manage Libraries > Type "RF24" (use V1.3.3!)
-#include <printf.h>
-#include <Servo.h>
-#include <statusLED.h> // https://github.com/TheDIYGuy999/statusLED
+#ifdef DEBUG
+#include <printf.h> // Uses "Serial", so only included for debugging (see uart.h)
+#endif
 #include <TB6612FNG.h> // https://github.com/TheDIYGuy999/TB6612FNG ***NOTE*** V1.2 required!! <<<-----
 #include <PWMFrequency.h> // https://github.com/TheDIYGuy999/PWMFrequency
-#include <PID_v1.h> // https://github.com/br3ttb/Arduino-PID-Library/
-#include "SBUS.h" // https://github.com/TheDIYGuy999/SBUS
 
 // Tabs (header files in sketch directory)
 #include "readVCC.h"
 #include "vehicleConfig.h"
+#include "profiler.h"
 #include "steeringCurves.h"
+#include "servos.h" // Timer 1 servo pulse engine (replaces the Servo library)
+#include "slew.h" // Time based ESC & motor ramps
+#include "lookupTables.h"
+#include "lights.h" // Interrupt driven light engine (uses Timer 1 of the servo engine)
 #include "tone.h"
-#include "balancing.h"
 #include "helper.h"
+#include "scheduler.h"
+#include "i2c.h" // Interrupt driven I2C (for the MPU-6050 gyro /accelerometer)
+#include "pid.h"
+#include "balancing.h"
+#include "latency.h"
+#include "linkQuality.h"
+#include "hopping.h"
 #include "pgmRead64.h" // Read 64 bit blocks from PROGMEM
+#include "uart.h" // Interrupt driven UART transmitter (if Serial is not used)
+#include "sbusFrame.h" // SBUS frame encoder
 
 //
 // =======================================================================================================
@@ -50,11 +73,7 @@ const float codeVersion = 3.9; // Software revision (see https://github.com/TheD
 // =======================================================================================================
 //
 
-// Radio channels (126 channels are supported)
-byte chPointer = 0; // Channel 1 (the first entry of the array) is active by default
-const byte NRFchannel[] {
-  1, 2
-};
+// Radio channels: see hopping.h
 
 // the ID number of the used "radio pipe" must match with the selected ID on the transmitter!
 // 20 ID's are available @ the moment
@@ -70,6 +89,7 @@ const int maxVehicleNumber = (sizeof(pipeIn) / (sizeof(uint64_t)));
 RF24 radio(8, 7);
 
 // The size of this struct should not exceed 32 bytes
+// Old packet format (8 bytes, or 9 bytes with sequence number). The packed format below is decoded into this struct
 struct RcData {
   byte axis1; // Aileron (Steering for car)
   byte axis2; // Elevator
@@ -79,27 +99,74 @@ struct RcData {
   boolean mode2 = false; // Mode2 (toggle acc. / dec. limitation)
   boolean momentary1 = false; // Momentary push button
   byte pot1; // Potentiometer
+  byte sequence; // Packet counter for link quality statistics (not sent by older transmitters)
 };
 RcData data;
+boolean rcDataSequence; // The last packet did contain a sequence number (older transmitters don't send it)
+
+// Packed packet format (10 bytes), detected by its size. Decoded with shift / mask operations in decodePacket()
+// byte 0: format ID (upper 4 bits = 0xA) and format version (lower 4 bits)
+// byte 1: sequence number
+// byte 2 - 9: bit 0 - 10 = axis1, 11 - 21 = axis2, 22 - 32 = axis3, 33 - 43 = axis4, 44 - 54 = pot1,
+// bit 55 = mode1, bit 56 = mode2, bit 57 = momentary1
+// The axes have 11 bit resolution: 0 - 2000 = 0 - 100%
+struct RcDataPacked {
+  byte format;
+  byte sequence;
+  byte bits[8];
+};
+const byte packedFormat = 0xA1; // ID 0xA, version 1
+
+// High resolution axes (0 - 2000 = 0 - 100%). Old packets are scaled up, so they are always valid
+struct RcDataHiRes {
+  uint16_t axis1;
+  uint16_t axis2;
+  uint16_t axis3;
+  uint16_t axis4;
+  uint16_t pot1;
+};
+RcDataHiRes dataHiRes;
+
+const byte maxPacketSize = sizeof(struct RcDataPacked) > sizeof(struct RcData) ? sizeof(struct RcDataPacked) : sizeof(struct RcData);
 
 // This struct defines data, which are embedded inside the ACK payload
+#ifdef COMPACT_TELEMETRY
+// Compact telemetry frame: voltages in mV instead of floats, plus one rotating extended field per frame.
+// The frame is updated in place and handed directly to writeAckPayload()
+enum telemetryField {
+  TELEMETRY_LOOP_TIME, // loop time in us
+  TELEMETRY_PACKETS, // received packets per second
+  TELEMETRY_PITCH, // MPU-6050 pitch angle in 0.01°
+  TELEMETRY_ROLL, // MPU-6050 roll angle in 0.01°
+  TELEMETRY_YAW_RATE, // MPU-6050 yaw rate in 0.1°/s
+  TELEMETRY_TEMPERATURE, // MPU-6050 temperature in 0.1°C
+  TELEMETRY_FIELDS
+};
+const byte telemetryFormat = 0xB0; // Upper 4 bits of "frameId", the lower 4 bits are the telemetryField
+
+struct ackPayload {
+  byte frameId = telemetryFormat; // format and field ID of "extended"
+  uint16_t vcc; // vehicle vcc voltage in mV
+  uint16_t batteryVoltage; // vehicle battery voltage in mV
+  boolean batteryOk = true; // the vehicle battery voltage is OK!
+  byte channel = 1; // the channel number
+  byte linkQuality = 100; // received packets in % (see linkQuality.h)
+  int16_t extended; // rotating extended field
+};
+#else
 struct ackPayload {
   float vcc; // vehicle vcc voltage
   float batteryVoltage; // vehicle battery voltage
   boolean batteryOk = true; // the vehicle battery voltage is OK!
   byte channel = 1; // the channel number
+  byte linkQuality = 100; // received packets in % (see linkQuality.h)
 };
+#endif
 ackPayload payload;
 
 // Battery voltage detection pin
 #define BATTERY_DETECT_PIN A7 // The 20k (to battery) & 10k (to GND) battery detection voltage divider is connected to pin A7
 
-// Create Servo objects
-Servo servo1;
-Servo servo2;
-Servo servo3;
-Servo servo4;
-
 // Special functions
 #define DIGITAL_OUT_1 1 // 1 = TXO Pin
 
@@ -111,19 +178,16 @@ boolean left;
 boolean right;
 boolean hazard;
 
+// Indicators use the same pins as the MPU-6050, so they can't be used in vehicleType 4 or 5!
+CONFIG_CONST boolean indicatorsUsable = indicators && vehicleType != 4 && vehicleType != 5;
+
 // Motors
 boolean isDriving; // is the vehicle driving?
 
 // Motor objects
 TB6612FNG Motor1;
 TB6612FNG Motor2;
-
-// Status LED objects
-statusLED tailLight(false); // "false" = output not inverted
-statusLED headLight(false);
-statusLED indicatorL(false);
-statusLED indicatorR(false);
-statusLED beaconLights(false);
+slewRamp motorRamp = {50L << 16, 0, 0, false}; // Driving motor throttle ramp (car & forklift, see slew.h)
 
 // Engine sound
 boolean engineOn = false;
@@ -131,46 +195,114 @@ boolean engineOn = false;
 // Serial commands to light and sound controller
 boolean serialCommands;
 
-// SBUS object
-#ifdef SBUS_SERIAL
-#ifndef DEBUG
-SBUS x8r(Serial);
-#endif
-#endif
-
 // ESC variables for tracked and half tracked mode
 int lEsc;
 int rEsc;
 
+//
+// =======================================================================================================
+// RADIO INTERRUPT (if "#define RADIO_IRQ_PIN" is active)
+// =======================================================================================================
+//
+
+// The interrupt only stores the micros() timestamp and sets a flag, as soon as the NRF24 IRQ pin goes low. The SPI
+// transfers stay in the main loop, so they never delay the servo and light interrupts and never collide with the SPI
+// access of the main loop (channel switching, radio setup). readRadio() only reads the radio, if the flag is set,
+// no SPI polling required.
+
+// Pin 2 is motor 2 IN2, pin 3 motor 2 PWM (board >= 1.3) or IN1 (board < 1.3). Motor2.begin() makes them outputs.
+#ifdef RADIO_IRQ_PIN
+#if RADIO_IRQ_PIN != 2 && RADIO_IRQ_PIN != 3
+#error "RADIO_IRQ_PIN must be 2 or 3 (external interrupt pins)"
+#elif RADIO_IRQ_PIN == 3
+#error "RADIO_IRQ_PIN 3 is used by motor 2, use pin 2 and MOTOR2_IN2_PIN"
+#elif !defined MOTOR2_IN2_PIN || MOTOR2_IN2_PIN == 2
+#error "RADIO_IRQ_PIN 2 is motor 2 IN2, re-wire IN2 and set MOTOR2_IN2_PIN"
+#endif
+#endif
+
+#ifdef RADIO_IRQ_PIN
+volatile boolean rxAvailable; // the IRQ pin went low
+volatile unsigned long rxTime; // micros() timestamp of the IRQ
+
+void radioIrq() {
+  rxTime = micros();
+  rxAvailable = true;
+}
+#endif
+
 //
 // =======================================================================================================
 // RADIO SETUP
 // =======================================================================================================
 //
 
-void setupRadio() {
-  radio.begin();
-  radio.setChannel(NRFchannel[chPointer]);
+// The radio setup is split into single steps. setupRadioStep() executes one step per call and returns true, when
+// the setup is complete. This allows to re-initialize the radio in readRadio() without blocking the main loop
+// for more than one step (the longest step is radio.begin()).
+byte radioSetupStep = 0;
+
+boolean setupRadioStep() {
+  switch (radioSetupStep) {
+    case 0:
+      radio.begin();
+      break;
+
+    case 1:
+      radio.setChannel(NRFchannel[chPointer]);
+      break;
+
+    case 2:
+      // Set Power Amplifier (PA) level to one of four levels: RF24_PA_MIN, RF24_PA_LOW, RF24_PA_HIGH and RF24_PA_MAX
+      radio.setPALevel(RF24_PA_HIGH); // HIGH
+      break;
 
-  // Set Power Amplifier (PA) level to one of four levels: RF24_PA_MIN, RF24_PA_LOW, RF24_PA_HIGH and RF24_PA_MAX
-  radio.setPALevel(RF24_PA_HIGH); // HIGH
+    case 3:
+      radio.setDataRate(RF24_250KBPS);
+      break;
+
+    case 4:
+      //radio.setAutoAck(pipeIn[vehicleNumber - 1], true); // Ensure autoACK is enabled
+      radio.setAutoAck(pgm_read_64(&pipeIn, vehicleNumber - 1), true); // Ensure autoACK is enabled
+      break;
+
+    case 5:
+      radio.enableAckPayload();
+      radio.enableDynamicPayloads();
+      break;
 
-  radio.setDataRate(RF24_250KBPS);
-  //radio.setAutoAck(pipeIn[vehicleNumber - 1], true); // Ensure autoACK is enabled
-  radio.setAutoAck(pgm_read_64(&pipeIn, vehicleNumber - 1), true); // Ensure autoACK is enabled
-  radio.enableAckPayload();
-  radio.enableDynamicPayloads();
-  radio.setRetries(5, 5);                  // 5x250us delay (blocking!!), max. 5 retries
-  //radio.setCRCLength(RF24_CRC_8);          // Use 8-bit CRC for performance
+    case 6:
+      radio.setRetries(5, 5);                  // 5x250us delay (blocking!!), max. 5 retries
+      //radio.setCRCLength(RF24_CRC_8);          // Use 8-bit CRC for performance
+      break;
+
+    case 7:
+      //radio.openReadingPipe(1, pipeIn[vehicleNumber - 1]);
+      radio.openReadingPipe(1, pgm_read_64(&pipeIn, vehicleNumber - 1));
+#ifdef RADIO_IRQ_PIN
+      radio.maskIRQ(true, true, false); // IRQ pin only active for received packets (not for sent ACK payloads)
+      pinMode(RADIO_IRQ_PIN, INPUT);
+      attachInterrupt(digitalPinToInterrupt(RADIO_IRQ_PIN), radioIrq, FALLING);
+#endif
+      break;
+
+    case 8:
+      radio.startListening();
+      radioSetupStep = 0;
+      return true; // setup complete
+  }
+  radioSetupStep ++;
+  return false;
+}
+
+// Blocking version (for setup() only)
+void setupRadio() {
+  while (!setupRadioStep());
 
 #ifdef DEBUG
   radio.printDetails();
   delay(3000);
 #endif
-
-  //radio.openReadingPipe(1, pipeIn[vehicleNumber - 1]);
-  radio.openReadingPipe(1, pgm_read_64(&pipeIn, vehicleNumber - 1));
-  radio.startListening();
 }
 
 //
@@ -188,7 +320,11 @@ void setupMotors() {
   const byte motor1_pwm = 6;
 
   byte motor2_in1;
+#ifdef MOTOR2_IN2_PIN
+  const byte motor2_in2 = MOTOR2_IN2_PIN; // re-wired (frees pin 2 for RADIO_IRQ_PIN)
+#else
   const byte motor2_in2 = 2;
+#endif
   byte motor2_pwm;
 
   // Switchable pins:
@@ -208,12 +344,13 @@ void setupMotors() {
 
   // Motor PWM frequency prescalers (Requires the PWMFrequency.h library)
   // Differential steering vehicles: locked to 984Hz, to make sure, that both motors use 984Hz.
-  if (vehicleType == 1 || vehicleType == 2 || vehicleType == 6) pwmPrescaler2 = 32;
+  byte prescaler2 = pwmPrescaler2;
+  if (vehicleType == 1 || vehicleType == 2 || vehicleType == 6) prescaler2 = 32;
 
   // ----------- IMPORTANT!! --------------
   // Motor 1 always runs @ 984Hz PWM frequency and can't be changed, because timers 0 an 1 are in use for other things!
   // Motor 2 (pin 3) can be changed to the following PWM frequencies: 32 = 984Hz, 8 = 3936Hz, 1 = 31488Hz
-  setPWMPrescaler(3, pwmPrescaler2); // pin 3 is hardcoded, because we can't change all others anyway
+  setPWMPrescaler(3, prescaler2); // pin 3 is hardcoded, because we can't change all others anyway
 }
 
 //
@@ -244,13 +381,17 @@ void setup() {
 #ifndef DEBUG
   // If TXO pin or RXI pin is used for other things, disable Serial
   if (TXO_momentary1 || TXO_toggle1 || headLights) {
+#ifndef UART_TX_INTERRUPT
     Serial.end(); // make sure, serial is off!
+#endif
     UCSR0B = 0b00000000;
     serialCommands = false;
   }
   else { // Otherwise use it for serial commands to the light and sound controller
 #ifdef SBUS_SERIAL
-    x8r.begin(); // begin the SBUS communication
+    setupUart(100000, UART_8E2); // begin the SBUS communication
+#elif defined BINARY_SERIAL
+    setupUart(115200, UART_8N1); // begin the binary frame communication
 #else
     Serial.begin(115200); // begin the standart serial communication
 #endif
@@ -260,25 +401,28 @@ void setup() {
 
   R2D2_tell();
 
-  // LED setup
-  if (vehicleType == 4 || vehicleType == 5 ) indicators = false; // Indicators use the same pins as the MPU-6050, so they can't be used in vehicleType 4 or 5!
+  // Timer 1 for the servo and light engines
+  setupServos();
 
-  if (tailLights) tailLight.begin(A1); // A1 = Servo 2 Pin
-  if (headLights) headLight.begin(0); // 0 = RXI Pin
-  if (indicators) {
-    indicatorL.begin(A4); // A4 = SDA Pin
-    indicatorR.begin(A5); // A5 = SCL Pin
+  // LED setup (see lights.h)
+  if (tailLights) lightAttach(LIGHT_TAIL); // A1 = Servo 2 Pin
+  if (headLights) lightAttach(LIGHT_HEAD); // 0 = RXI Pin
+  if (indicatorsUsable) {
+    lightAttach(LIGHT_INDICATOR_L); // A4 = SDA Pin
+    lightAttach(LIGHT_INDICATOR_R); // A5 = SCL Pin
   }
-  if (beacons) beaconLights.begin(A3); // A3 = Servo 4 Pin
+  if (beacons) lightAttach(LIGHT_BEACON); // A3 = Servo 4 Pin
+  setupLights(); // The lights are refreshed by the interrupt from now on, even during the setup
 
   // Radio setup
   setupRadio();
 
   // Servo pins
-  servo1.attach(A0);
-  if (!tailLights) servo2.attach(A1);
-  if (!engineSound && !toneOut) servo3.attach(A2);
-  if (!beacons) servo4.attach(A3);
+  servoAttach(SERVO1); // A0
+  if (!tailLights) servoAttach(SERVO2); // A1
+  if (!engineSound && !toneOut) servoAttach(SERVO3); // A2
+  if (!beacons) servoAttach(SERVO4); // A3
+  servoUpdate();
 
   // Special functions
   if (TXO_momentary1 || TXO_toggle1) pinMode(DIGITAL_OUT_1, OUTPUT);
@@ -293,6 +437,9 @@ void setup() {
     // PID controller setup
     setupPid();
   }
+
+  // Periodic tasks start now (after the blocking setup functions)
+  setupScheduler();
 }
 
 //
@@ -337,28 +484,28 @@ void led() {
 
   // Lights are switching off 10s after the vehicle did stop
   if (millis() - millisLightOff >= 10000) {
-    headLight.off(); // Headlight off
-    tailLight.off(); // Taillight off
-    beaconLights.off(); // Beacons off
+    lightPattern(LIGHT_HEAD, lightOffPattern); // Headlight off
+    lightPattern(LIGHT_TAIL, lightOffPattern); // Taillight off
+    lightPattern(LIGHT_BEACON, lightOffPattern); // Beacons off
   }
   else {
-    if (!escBrakeLights && (!HP && Motor1.brakeActive() || HP && Motor2.brakeActive() )) { // if braking detected from TB6612FNG motor driver
-      tailLight.on(); // Brake light (full brightness)
+    if (!escBrakeLights && motorRamp.braking) { // if the TB6612FNG driving motor throttle ramp is decelerating
+      lightPattern(LIGHT_TAIL, lightOnPattern); // Brake light (full brightness)
     }
 
     else if (escBrakeLights && escBrakeActive() ) { // or braking detected from ESC
-      tailLight.on(); // Brake light (full brightness)
+      lightPattern(LIGHT_TAIL, lightOnPattern); // Brake light (full brightness)
     }
 
     else {
-      tailLight.flash(10, 14, 0, 0); // Taillight: 10 on  / 14 off = about 40% brightness (soft PWM)
+      lightPattern(LIGHT_TAIL, lightTailPattern); // Taillight: dimmed
     }
-    beaconLights.flash(50, 650, 0, 0); // Simulate rotating beacon lights with short flashes
-    headLight.on(); // Headlight on
+    lightPattern(LIGHT_BEACON, lightBeaconPattern); // Simulate rotating beacon lights with short flashes
+    lightPattern(LIGHT_HEAD, lightHeadPattern); // Headlight on
   }
 
   // Indicator lights ----
-  if (indicators) {
+  if (indicatorsUsable) {
     // Set and reset by lever
     if (data.axis4 < 5) left = true;
     if (data.axis4 > 55) left = false;
@@ -382,52 +529,194 @@ void led() {
     // Lights
     if (left) { // Left indicator
       right = false;
-      indicatorL.flash(375, 375, 0, 0);
-      indicatorR.off();
+      lightPattern(LIGHT_INDICATOR_L, lightIndicatorPattern);
+      lightPattern(LIGHT_INDICATOR_R, lightOffPattern);
     }
 
     if (right) { // Right indicator
       left = false;
-      indicatorR.flash(375, 375, 0, 0);
-      indicatorL.off();
+      lightPattern(LIGHT_INDICATOR_R, lightIndicatorPattern);
+      lightPattern(LIGHT_INDICATOR_L, lightOffPattern);
     }
 
     if (hazard) { // Hazard lights
       if (left) {
         left = false;
-        indicatorL.off();
+        lightPattern(LIGHT_INDICATOR_L, lightOffPattern);
       }
       if (right) {
         right = false;
-        indicatorR.off();
+        lightPattern(LIGHT_INDICATOR_R, lightOffPattern);
       }
-      indicatorL.flash(375, 375, 0, 0);
-      indicatorR.flash(375, 375, 0, 0);
+      lightPattern(LIGHT_INDICATOR_L, lightIndicatorPattern);
+      lightPattern(LIGHT_INDICATOR_R, lightIndicatorPattern);
     }
 
     if (!hazard && !left && !right) {
-      indicatorL.off();
-      indicatorR.off();
+      lightPattern(LIGHT_INDICATOR_L, lightOffPattern);
+      lightPattern(LIGHT_INDICATOR_R, lightOffPattern);
     }
   }
 }
 
+//
+// =======================================================================================================
+// ACK PAYLOAD TELEMETRY (if "#define COMPACT_TELEMETRY" is active)
+// =======================================================================================================
+//
+
+// Selects the next extended field after every received packet, so all fields are sent in turn
+#ifdef COMPACT_TELEMETRY
+void telemetryUpdate(boolean packetReceived) {
+  static byte field;
+  static unsigned long lastLoop;
+  static unsigned int loopMicros;
+
+  unsigned long now = micros();
+  loopMicros = now - lastLoop;
+  lastLoop = now;
+
+  if (!packetReceived) return;
+  field ++;
+  if (field >= TELEMETRY_FIELDS) field = 0;
+
+  int16_t value = 0;
+  switch (field) {
+    case TELEMETRY_LOOP_TIME: value = loopMicros; break;
+    case TELEMETRY_PACKETS: value = linkPacketsPerSecond; break;
+    case TELEMETRY_PITCH: value = angle_pitch * 100; break;
+    case TELEMETRY_ROLL: value = angle_roll * 100; break;
+    case TELEMETRY_YAW_RATE: value = yaw_rate * 10; break;
+    case TELEMETRY_TEMPERATURE: value = temperature / 34 + 365; break; // MPU-6050: °C = raw / 340 + 36.53
+  }
+
+  payload.frameId = telemetryFormat | field;
+  payload.extended = value;
+}
+#else // Empty function, if the old ACK payload format is used
+void telemetryUpdate(boolean) {}
+#endif
+
 //
 // =======================================================================================================
 // READ RADIO DATA
 // =======================================================================================================
 //
 
-void readRadio() {
+// Extract an 11 bit axis, starting at bit "position"
+uint16_t unpackAxis(const byte *bits, byte position) {
+  const byte *p = bits + (position >> 3);
+  uint32_t word = p[0] | (uint16_t)p[1] << 8 | (uint32_t)p[2] << 16;
+  uint16_t value = (word >> (position & 7)) & 0x7FF;
+  if (value > 2000) value = 2000;
+  return value;
+}
 
-  static unsigned long lastRecvTime = 0;
+// Decodes a received packet into "data" and "dataHiRes". Returns false, if the size or the format is unknown
+// Valid sizes: packed format, old format with or without sequence number
+boolean decodePacket(const byte *packet, byte size) {
+  if (size == sizeof(struct RcDataPacked)) { // Packed format
+    if (packet[0] != packedFormat) {
+      linkBadPacket();
+      return false;
+    }
+    const byte *bits = packet + 2;
+    dataHiRes.axis1 = unpackAxis(bits, 0);
+    dataHiRes.axis2 = unpackAxis(bits, 11);
+    dataHiRes.axis3 = unpackAxis(bits, 22);
+    dataHiRes.axis4 = unpackAxis(bits, 33);
+    dataHiRes.pot1 = unpackAxis(bits, 44);
+    data.axis1 = (dataHiRes.axis1 + 10) / 20; // 0 - 100 for all other functions
+    data.axis2 = (dataHiRes.axis2 + 10) / 20;
+    data.axis3 = (dataHiRes.axis3 + 10) / 20;
+    data.axis4 = (dataHiRes.axis4 + 10) / 20;
+    data.pot1 = (dataHiRes.pot1 + 10) / 20;
+    data.mode1 = bits[6] >> 7;
+    data.mode2 = bits[7] & 1;
+    data.momentary1 = (bits[7] >> 1) & 1;
+    data.sequence = packet[1];
+    rcDataSequence = true;
+  }
+  else if (size == sizeof(struct RcData) || size == offsetof(struct RcData, sequence)) { // Old format
+    memcpy(&data, packet, size);
+    dataHiRes.axis1 = data.axis1 * 20;
+    dataHiRes.axis2 = data.axis2 * 20;
+    dataHiRes.axis3 = data.axis3 * 20;
+    dataHiRes.axis4 = data.axis4 * 20;
+    dataHiRes.pot1 = data.pot1 * 20;
+    rcDataSequence = size == sizeof(struct RcData);
+  }
+  else {
+    linkBadPacket();
+    return false;
+  }
+  return true;
+}
+
+// Returns true, if a new packet was decoded into "data"
+boolean receivePacket() {
+  byte packet[maxPacketSize];
+  byte size;
+
+#ifdef RADIO_IRQ_PIN
   byte pipeNo;
 
-  if (radio.available(&pipeNo)) {
+  if (!rxAvailable && digitalRead(RADIO_IRQ_PIN) == HIGH) return false; // no IRQ (pin still low: edge before attachInterrupt())
+  noInterrupts(); // the interrupt writes the 32 bit timestamp
+  unsigned long timestamp = rxAvailable ? rxTime : micros();
+  rxAvailable = false;
+  interrupts();
+
+  bool txOk, txFail, rxReady;
+  radio.whatHappened(txOk, txFail, rxReady); // clear the IRQ flag, packets, which arrive from now on, cause a new IRQ
+  size = 0;
+  while (radio.available(&pipeNo)) { // read all packets, which arrived since the IRQ. The newest one is decoded
+    byte packetSize = radio.getDynamicPayloadSize();
+    if (packetSize == 0) continue; // corrupted packet, flushed by the RF24 library
+    if (packetSize > maxPacketSize) packetSize = maxPacketSize;
     radio.writeAckPayload(pipeNo, &payload, sizeof(struct ackPayload) );  // prepare the ACK payload
-    radio.read(&data, sizeof(struct RcData)); // read the radia data and send out the ACK payload
+    radio.read(packet, packetSize); // read the radio data and send out the ACK payload
+    size = packetSize;
+  }
+  if (size == 0) return false;
+  latencyPacket(timestamp);
+#else
+  byte pipeNo;
+
+  if (!radio.available(&pipeNo)) return false;
+  size = radio.getDynamicPayloadSize();
+  if (size == 0) return false; // corrupted packet, flushed by the RF24 library
+  if (size > maxPacketSize) size = maxPacketSize;
+  radio.writeAckPayload(pipeNo, &payload, sizeof(struct ackPayload) );  // prepare the ACK payload
+  radio.read(packet, size); // read the radia data and send out the ACK payload
+  latencyPacket(micros());
+#endif
+
+  return decodePacket(packet, size);
+}
+
+void readRadio() {
+
+  static unsigned long lastRecvTime = 0;
+  static boolean radioReinit = false;
+
+  // Radio re-initialisation in progress: one setup step per loop
+  if (radioReinit) {
+    if (setupRadioStep()) {
+      radioReinit = false;
+      linkReinit();
+      lastRecvTime = millis();
+    }
+    return;
+  }
+
+  boolean packetReceived = receivePacket();
+  telemetryUpdate(packetReceived);
+
+  if (packetReceived) {
     hazard = false;
     lastRecvTime = millis();
+    hopPacketReceived(linkPacket(rcDataSequence, data.sequence));
 #ifdef DEBUG
     Serial.print(data.axis1);
     Serial.print("\t");
@@ -440,12 +729,11 @@ void readRadio() {
 #endif
   }
 
-  // Switch channel
-  if (millis() - lastRecvTime > 500) {
-    chPointer ++;
-    if (chPointer >= sizeof((*NRFchannel) / sizeof(byte))) chPointer = 0;
+  // Switch channel (see hopping.h)
+  if (hopUpdate(millis() - lastRecvTime)) {
     radio.setChannel(NRFchannel[chPointer]);
     payload.channel = NRFchannel[chPointer];
+    linkChannelSwitch();
   }
 
   if (millis() - lastRecvTime > 1000) { // set all analog values to their middle position, if no RC signal is received during 1s!
@@ -453,6 +741,10 @@ void readRadio() {
     data.axis2 = 50; // Elevator
     data.axis3 = 50; // Throttle
     data.axis4 = 50; // Rudder
+    dataHiRes.axis1 = 1000;
+    dataHiRes.axis2 = 1000;
+    dataHiRes.axis3 = 1000;
+    dataHiRes.axis4 = 1000;
     hazard = true; // Enable hazard lights
     payload.batteryOk = true; // Clear low battery alert (allows to re-enable the vehicle, if you switch off the transmitter)
 #ifdef DEBUG
@@ -461,9 +753,12 @@ void readRadio() {
   }
 
   if (millis() - lastRecvTime > 2000) {
-    setupRadio(); // re-initialize radio
-    lastRecvTime = millis();
+    radioReinit = true; // re-initialize radio, starting with the next loop
   }
+
+  // Link quality statistics
+  if (linkUpdate()) hopQualityUpdate();
+  payload.linkQuality = linkQualityPercent;
 }
 
 //
@@ -475,14 +770,8 @@ void readRadio() {
 void writeServos() {
   // Servo 1 --------------------------------
   // Aileron or Steering
-  if (vehicleType != 5) { // If not car with MSRC stabilty control
-#ifndef STEERING_3_POINT_CAL
-    servo1.write(map(data.axis1, 100, 0, lim1L, lim1R) ); // 45 - 135°
-#else
-    if (data.axis1 < 50) servo1.write(map(data.axis1, 50, 0, lim1C, lim1R) );
-    else if (data.axis1 > 50) servo1.write(map(data.axis1, 100, 50, lim1L, lim1C) );
-    else servo1.write (lim1C);
-#endif
+  if (!mrscActive()) { // If not car with MSRC stabilty control
+    servoWriteMicroseconds(SERVO1, readLut(servo1Lut, data.axis1) ); // 45 - 135° (or 3 point calibrated, see lookupTables.h)
   }
 
   // Servo 2 --------------------------------
@@ -490,25 +779,25 @@ void writeServos() {
 #ifdef TWO_SPEED_GEARBOX // Shifting gearbox mode, controlled by "Mode 1" button
   if (!tailLights ) {
     if (data.axis3 < 45 || data.axis3 > 55) { // Don't change gear while WPL transmission is standing still!
-      if (data.mode1)servo2.write(lim2L);
-      else servo2.write(lim2R);
+      if (data.mode1)servoWrite(SERVO2, lim2L);
+      else servoWrite(SERVO2, lim2R);
     }
   }
 
 #else
 #ifdef THREE_SPEED_GEARBOX // Shifting gearbox mode, controlled by 3 position switch
   if (!tailLights) {
-    if (data.axis2 < 10)servo2.write(lim2R);
-    else if (data.axis2 > 90)servo2.write(lim2L);
-    else servo2.write(lim2C);
+    if (data.axis2 < 10)servoWrite(SERVO2, lim2R);
+    else if (data.axis2 > 90)servoWrite(SERVO2, lim2L);
+    else servoWrite(SERVO2, lim2C);
   }
 
 #else // Servo controlled by joystick CH2
   if (vehicleType != 1 && vehicleType != 2 && vehicleType != 6) {
-    if (!tailLights) servo2.write(map(data.axis2, 100, 0, lim2L, lim2R) ); // 45 - 135°
+    if (!tailLights) servoWriteMicroseconds(SERVO2, readLut(servo2Lut, data.axis2) ); // 45 - 135°
   }
   else { // Tracked or half tracked or differential thrust mode
-    servo2.write(map(lEsc, 100, 0, lim2L, lim2R) ); // 45 - 135°
+    servoWriteMicroseconds(SERVO2, map(lEsc, 100, 0, servoMicroseconds(lim2L), servoMicroseconds(lim2R)) ); // 45 - 135°
   }
 #endif
 #endif
@@ -517,40 +806,32 @@ void writeServos() {
   // Throttle (for ESC control, if you don't use the internal TB6612FNG motor driver)
 
 #if defined ESC_MICROSECONDS
-  uint16_t servo3Microseconds = 1500;
-  static uint16_t servo3Microseconds2 = 1500;
-  static long previousThrottleRampMillis;
-
-  if (millis() - previousThrottleRampMillis >= 1) {
-    previousThrottleRampMillis = millis();
-    servo3Microseconds = map(data.axis3, 100, 0, 2000, 1000);
-    servo3Microseconds = reMap(curveExponentialThrottle, servo3Microseconds);
-    if (servo3Microseconds2 < servo3Microseconds) servo3Microseconds2 ++;
-    if (servo3Microseconds2 > servo3Microseconds) servo3Microseconds2 --;
-    servo3.writeMicroseconds(servo3Microseconds2);
-  }
+  static slewRamp escRamp = {1500L << 16, 0, 0, false};
+
+  uint16_t servo3Microseconds = readLut(escMicrosecondsLut, data.axis3); // including exponential throttle curve
+  servoWriteMicroseconds(SERVO3, slewUpdate(escRamp, servo3Microseconds, 1500, escSlewProfile)); // see slew.h
 #else
 
   if (vehicleType != 1 && vehicleType != 2 && vehicleType != 6) {
     if (data.mode1) { // limited speed!
-      servo3.write(map(data.axis3, 100, 0, lim3Llow, lim3Rlow ) ); // less than +/- 45°
+      servoWriteMicroseconds(SERVO3, readLut(servo3LowLut, data.axis3) ); // less than +/- 45°
     }
     else { // full speed!
-      servo3.write(map(data.axis3, 100, 0, lim3L, lim3R) ); // 45 - 135°
+      servoWriteMicroseconds(SERVO3, readLut(servo3Lut, data.axis3) ); // 45 - 135°
     }
   }
   else { // Tracked or half tracked or differential thrust mode
-    servo3.write(map(rEsc, 100, 0, lim3L, lim3R) ); // 45 - 135°
+    servoWriteMicroseconds(SERVO3, map(rEsc, 100, 0, servoMicroseconds(lim3L), servoMicroseconds(lim3R)) ); // 45 - 135°
   }
 #endif
 
   // Axis 2 on the joystick switches engine sound on servo channel 3 on and off!
   if (engineSound) {
     if (data.axis2 > 80) {
-      servo3.attach(A2); // Enable servo 3 pulse
+      servoAttach(SERVO3); // Enable servo 3 pulse
     }
     if (data. axis2 < 20) {
-      servo3.detach(); // Disable servo 3 pulse = engine off signal for "TheDIYGuy999" engine simulator!
+      servoDetach(SERVO3); // Disable servo 3 pulse = engine off signal for "TheDIYGuy999" engine simulator!
     }
   }
 
@@ -558,18 +839,21 @@ void writeServos() {
   // Rudder or trailer unlock actuator
 #ifdef TRACTOR_TRAILER_UNLOCK // Tractor trailer unlocking, controlled by "Momentary 1" ("Back / Pulse") button
   if (!beacons && !potentiometer1) {
-    if (data.momentary1)servo4.write(lim4L);
-    else servo4.write(lim4R);
+    if (data.momentary1)servoWrite(SERVO4, lim4L);
+    else servoWrite(SERVO4, lim4R);
   }
 
 #else // Servo controlled by joystick CH4 
   if (!potentiometer1) { // Servo 4 controlled by CH4
-    if (!beacons) servo4.write(map(data.axis4, 100, 0, lim4L, lim4R) ); // 45 - 135°
+    if (!beacons) servoWriteMicroseconds(SERVO4, readLut(servo4Lut, data.axis4) ); // 45 - 135°
   }
   else { // Servo 4 controlled by transmitter potentiometer knob
-    if (!beacons) servo4.write(map(data.pot1, 0, 100, 45, 135) ); // 45 - 135°
+    if (!beacons) servoWriteMicroseconds(SERVO4, readLut(potLut, data.pot1) ); // 45 - 135°
   }
 #endif
+
+  // Hand the new pulse widths of all channels to the servo engine (takes effect with the next frame)
+  servoUpdate();
 }
 
 //
@@ -581,7 +865,6 @@ void writeServos() {
 void driveMotorsCar() {
 
   int maxPWM;
-  byte maxAcceleration;
 
   // Speed limitation (max. is 255)
   if (data.mode1) {
@@ -592,27 +875,23 @@ void driveMotorsCar() {
 
   if (!payload.batteryOk && liPo) data.axis3 = 50; // Stop the vehicle, if the battery is empty!
 
-  // Acceleration & deceleration limitation (ms per 1 step input signal change)
-  if (data.mode2) {
-    maxAcceleration = maxAccelerationLimited; // Limited
-  } else {
-    maxAcceleration = maxAccelerationFull; // Full
-  }
-
+  // Acceleration & deceleration limitation (ms per 1 step input signal change, see slew.h)
   // ***************** Note! The ramptime is intended to protect the gearbox! *******************
-  // SYNTAX: Input value, max PWM, ramptime in ms per 1 PWM increment
+  int throttle = slewUpdate(motorRamp, data.axis3, 50, data.mode2 ? motorSlewLimited : motorSlewFull);
+
+  // SYNTAX: Input value, max PWM, ramptime in ms per 1 PWM increment (0, the input is already ramped)
   // false = brake in neutral position inactive
 
   if (!HP) { // Two channel version: ----
-    if (Motor1.drive(data.axis3, minPWM, maxPWM, maxAcceleration, true) ) { // The drive motor (function returns true, if not in neutral)
+    if (Motor1.drive(throttle, minPWM, maxPWM, 0, true) ) { // The drive motor (function returns true, if not in neutral)
       millisLightOff = millis(); // Reset the headlight delay timer, if the vehicle is driving!
     }
-    if (vehicleType != 5) { // If not car with MSRC stabilty control
+    if (!mrscActive()) { // If not car with MSRC stabilty control
       Motor2.drive(data.axis1, 0, steeringTorque, 0, false); // The steering motor (if the original steering motor is reused instead of a servo)
     }
   }
   else { // High Power "HP" version. Motor 2 is the driving motor, no motor 1: ----
-    if (Motor2.drive(data.axis3, minPWM, maxPWM, maxAcceleration, true) ) { // The drive motor (function returns true, if not in neutral)
+    if (Motor2.drive(throttle, minPWM, maxPWM, 0, true) ) { // The drive motor (function returns true, if not in neutral)
       millisLightOff = millis(); // Reset the headlight delay timer, if the vehicle is driving!
     }
   }
@@ -627,7 +906,6 @@ void driveMotorsCar() {
 void driveMotorsForklift() {
 
   int maxPWM;
-  byte maxAcceleration;
 
   // Speed limitation (max. is 255)
   if (data.mode1) {
@@ -638,19 +916,14 @@ void driveMotorsForklift() {
 
   if (!payload.batteryOk && liPo) data.axis3 = 50; // Stop the vehicle, if the battery is empty!
 
-  // Acceleration & deceleration limitation (ms per 1 step input signal change)
-  if (data.mode2) {
-    maxAcceleration = maxAccelerationLimited; // Limited
-  } else {
-    maxAcceleration = maxAccelerationFull; // Full
-  }
-
+#if not defined VEHICLE_TYPE_3_WITH_ESC // Motor driver 1 used for driving motor, no ESC
+  // Acceleration & deceleration limitation (ms per 1 step input signal change, see slew.h)
   // ***************** Note! The ramptime is intended to protect the gearbox! *******************
-  // SYNTAX: Input value, max PWM, ramptime in ms per 1 PWM increment
-  // false = brake in neutral position inactive
+  int throttle = slewUpdate(motorRamp, data.axis3, 50, data.mode2 ? motorSlewLimited : motorSlewFull);
 
-#if not defined VEHICLE_TYPE_3_WITH_ESC // Motor driver 1 used for driving motor, no ESC
-  if (Motor1.drive(data.axis3, minPWM, maxPWM, maxAcceleration, true) ) { // The drive motor (function returns true, if not in neutral)
+  // SYNTAX: Input value, max PWM, ramptime in ms per 1 PWM increment (0, the input is already ramped)
+  // false = brake in neutral position inactive
+  if (Motor1.drive(throttle, minPWM, maxPWM, 0, true) ) { // The drive motor (function returns true, if not in neutral)
     millisLightOff = millis(); // Reset the headlight delay timer, if the vehicle is driving!
   }
 #else // Motor driver 1 can be used for other stuff, if vehicle has dedicated ESC
@@ -676,52 +949,36 @@ void driveMotorsSteering() {
   int steeringFactorLeft2;
   int steeringFactorRight2;
 
-  // The input signal range
-  const int servoMin = 5;
-  const int servoMax = 95;
-  const int servoNeutralMin = 48;
-  const int servoNeutralMax = 52;
-
-  // Compute steering overlay:
+  // Compute steering overlay (input signal range see lookupTables.h):
   // The steering signal is channel 1 = data.axis1
   // 100% = wheel spins with 100% of the requested speed forward
   // -100% = wheel spins with 100% of the requested speed backward
-  if (data.axis1 <= servoNeutralMin) {
-    steeringFactorLeft = map(data.axis1, servoMin, servoNeutralMin, 0, 100);
-    steeringFactorLeft = constrain(steeringFactorLeft, 0, 100);
-  }
-  else {
-    steeringFactorLeft = 100;
-  }
-
-  if (data.axis1 >= servoNeutralMax) {
-    steeringFactorRight = map(data.axis1, servoMax, servoNeutralMax, 0, 100);
-    steeringFactorRight = constrain(steeringFactorRight, 0, 100);
-  }
-  else {
-    steeringFactorRight = 100;
-  }
+  profileBegin(PROFILE_STEERING);
+  steeringFactorLeft = readLut(steeringFactorLeftLut, data.axis1);
+  steeringFactorRight = readLut(steeringFactorRightLut, data.axis1);
 
   // Nonlinear steering overlay correction
   if (vehicleType == 6) {
-    steeringFactorLeft2 = reMap(curveThrust, steeringFactorLeft); // Differential thrust mode
-    steeringFactorRight2 = reMap(curveThrust, steeringFactorRight);
+    steeringFactorLeft2 = readLut(curveThrustLut, steeringFactorLeft); // Differential thrust mode
+    steeringFactorRight2 = readLut(curveThrustLut, steeringFactorRight);
     data.axis3 = constrain(data.axis3, 50, 100); // reverse locked!
   }
   if (vehicleType == 2) {
-    steeringFactorLeft2 = reMap(curveFull, steeringFactorLeft); // Caterpillar mode
-    steeringFactorRight2 = reMap(curveFull, steeringFactorRight);
+    steeringFactorLeft2 = readLut(curveFullLut, steeringFactorLeft); // Caterpillar mode
+    steeringFactorRight2 = readLut(curveFullLut, steeringFactorRight);
   }
   if (vehicleType == 1) {
-    steeringFactorLeft2 = reMap(curveSemi, steeringFactorLeft); // Semi caterpillar mode
-    steeringFactorRight2 = reMap(curveSemi, steeringFactorRight);
+    steeringFactorLeft2 = readLut(curveSemiLut, steeringFactorLeft); // Semi caterpillar mode
+    steeringFactorRight2 = readLut(curveSemiLut, steeringFactorRight);
   }
 
   // Drive caterpillar motors
   // The throttle signal (for both caterpillars) is channel 3 = data.axis3
   // -100 to 100%
-  pwm[0] = map(data.axis3, servoMin, servoMax, 100, -100) * steeringFactorRight2 / 100;
-  pwm[1] = map(data.axis3, servoMin, servoMax, 100, -100) * steeringFactorLeft2 / 100;
+  int throttle = readLut(steeringThrottleLut, data.axis3);
+  pwm[0] = throttle * steeringFactorRight2 / 100;
+  pwm[1] = throttle * steeringFactorLeft2 / 100;
+  profileEnd(PROFILE_STEERING);
 
   pwm[0] = map(pwm[0], 100, -100, 100, 0); // convert -100 to 100% to 0-100 for motor control
   pwm[1] = map(pwm[1], 100, -100, 100, 0);
@@ -753,17 +1010,17 @@ void driveMotorsBalancing() {
   // The steering overlay is in degrees per second, controlled by the MPU 6050 yaw rate and yoystick axis 1
   int steering = ((data.axis1 - 50) / 7) - yaw_rate; // -50 to 50 / 8 = 7°/s - yaw_rate
   steering = constrain(steering, -7, 7);
-  int speed = angleOutput + 50;
+  int speed = (angleOutput >> 16) + 50;
 
   // Calculate averaged motor power (speed) for speed controller feedback
   static unsigned long lastSpeed;
   if (millis() - lastSpeed >= 8) {  // 8ms
-    speedAveraged = (speedAveraged * 3.0 + angleOutput) / 4.0; // 1:4 (1:8)
+    speedAveraged = (speedAveraged * 3 * 65536L + angleOutput) / (4 * 65536L); // 1:4 (1:8)
   }
 
   speed = constrain(speed, 7, 93); // same range as in setupPID() + 50 offset from above!
 
-  if (angleMeasured > -20.0 && angleMeasured < 20.0) { // Only drive motors, if robot stands upright
+  if (angleMeasured > -20 * 65536L && angleMeasured < 20 * 65536L) { // Only drive motors, if robot stands upright
     Motor1.drive(speed - steering, minPWM, maxPWMfull, 0, false); // left caterpillar, 0ms ramp! 50 = neutral!
     Motor2.drive(speed + steering, minPWM, maxPWMfull, 0, false); // right caterpillar
   }
@@ -782,36 +1039,49 @@ void driveMotorsBalancing() {
 void balancing() {
 
   // Read sensor data
+  throttleNeutral = abs(data.axis3 - 50) < 5; // The gyro offsets are tracked, if the throttle is in neutral position
   readMpu6050Data();
 
-  angleMeasured = angle_pitch - tiltCalibration;
+  angleMeasured = angle_pitch_fx - tiltOffset;
 
   // Read speed pot with 0.2s fader
-  static unsigned long lastPot;
-  if (millis() - lastPot >= 40) { // 40ms
-    lastPot = millis();
+  if (taskDue(TASK_SPEED_POT)) { // 40ms (see scheduler.h)
     speedPot = (speedPot * 4 + data.axis3) / 5; // 1:5
   }
 
   // PID Parameters (Test)
-  double speedKp = 0.9, speedKi = 0.03, speedKd = 0.0;
-  double angleKp = data.pot1 / 8.0, angleKi = 25.0, angleKd = 0.12; // /You need to connect a potentiometer to the transmitter analog input A6
+  const float speedKp = 0.9, speedKi = 0.03, speedKd = 0.0;
+  const float angleKi = 25.0, angleKd = 0.12; // angleKp = data.pot1 / 8.0: You need to connect a potentiometer to the transmitter analog input A6
 
   // PID Parameters (Working)
-  //double speedKp = 0.9, speedKi = 0.03, speedKd = 0.0;
-  //double angleKp = data.pot1 / 8.0, angleKi = 25.0, angleKd = 0.12; // You need to connect a potentiometer to the transmitter analog input A6
+  //const float speedKp = 0.9, speedKi = 0.03, speedKd = 0.0;
+  //const float angleKi = 25.0, angleKd = 0.12; // angleKp = data.pot1 / 8.0: You need to connect a potentiometer to the transmitter analog input A6
+
+  // The gains are only converted, if the pot value has changed
+  static int lastPot1 = -1;
+  if (data.pot1 != lastPot1) {
+    lastPot1 = data.pot1;
+    pidSetTunings(speedPid, speedKp, speedKi, speedKd, speedPidRate);
+    pidSetTunings(anglePid, data.pot1 / 8.0, angleKi, angleKd, anglePidRate);
+  }
 
   // Speed PID controller (important to protect the robot from falling over at full motor rpm!)
-  speedTarget = ((float)speedPot - 50.0) / 1.51; // (100 - 50) / 1.51 = Range of about +/- 33 (same as in setupPid() !)
-  speedMeasured = speedAveraged * 1.3; //angleOutput; // 43 / 33 = 1.3
-  speedPid.SetTunings(speedKp, speedKi, speedKd);
-  speedPid.Compute();
+  if (taskDue(TASK_SPEED_PID)) {
+    speedTarget = (speedPot - 50) * 43401L; // (100 - 50) / 1.51 = Range of about +/- 33 (same as in setupPid() !) 65536 / 1.51 = 43401
+    speedMeasured = speedAveraged * 85197L; //angleOutput; // 43 / 33 = 1.3 65536 * 1.3 = 85197
+    profileBegin(PROFILE_SPEED_PID);
+    speedOutput = pidCompute(speedPid, speedTarget, speedMeasured);
+    profileEnd(PROFILE_SPEED_PID);
+  }
 
   // Angle PID controller
-  angleTarget = speedOutput / -8.25; // 33.0 (from above) / 8.25 = Range of about +/- 4.0° tilt angle
-  //  angleTarget = (speedPot - 50) / -12.5; // 50 / 12.5 = Range of about +/- 4.0° tilt angle
-  anglePid.SetTunings(angleKp, angleKi, angleKd);
-  anglePid.Compute();
+  if (taskDue(TASK_ANGLE_PID)) {
+    angleTarget = -(speedOutput * 4 / 33); // 33.0 (from above) / 8.25 = Range of about +/- 4.0° tilt angle
+    //  angleTarget = (speedPot - 50) * 65536L / -12.5; // 50 / 12.5 = Range of about +/- 4.0° tilt angle
+    profileBegin(PROFILE_ANGLE_PID);
+    angleOutput = pidCompute(anglePid, angleTarget, angleMeasured);
+    profileEnd(PROFILE_ANGLE_PID);
+  }
 
   // Send the calculated values to the motors
   driveMotorsBalancing();
@@ -834,6 +1104,7 @@ void balancing() {
 void mrsc() {
 
   // Read sensor data
+  throttleNeutral = abs(data.axis3 - 50) < 5; // The gyro offsets are tracked, if the throttle is in neutral position
   readMpu6050Data();
 
   // If the MRSC gain is a fixed value, read it!
@@ -849,7 +1120,8 @@ void mrsc() {
   steeringAngle = constrain (steeringAngle, -50, 50); // range = -50 to 50
 
   // Control steering servo (MRSC mode only)
-  servo1.write(map(steeringAngle, 50, -50, lim1L, lim1R) ); // 45 - 135°
+  servoWriteMicroseconds(SERVO1, readLut(servo1LinearLut, steeringAngle + 50) ); // 45 - 135°
+  servoUpdate();
 
   // Control motor 2 (steering, not on "High Power" board type)
   if (!HP) {
@@ -910,27 +1182,34 @@ void checkBattery() {
     isDriving = true; // under load
   }
 
-  // Every 1000 ms, take measurements
-  static unsigned long lastTrigger;
-  if (millis() - lastTrigger >= 1000) {
-    lastTrigger = millis();
+  // Every 1000 ms, take measurements (see scheduler.h)
+  if (taskDue(TASK_BATTERY)) {
+
+    // Read both averaged voltages (mV)
+    unsigned int batteryMillivolts = batteryAverage();
+    unsigned int vccMillivolts = vccAverage();
+    unsigned int cutoffMillivolts = cutoffVoltage * 1000;
 
-    // Read both averaged voltages
-    payload.batteryVoltage = batteryAverage();
-    payload.vcc = vccAverage();
+#ifdef COMPACT_TELEMETRY
+    payload.batteryVoltage = batteryMillivolts;
+    payload.vcc = vccMillivolts;
+#else
+    payload.batteryVoltage = batteryMillivolts / 1000.0;
+    payload.vcc = vccMillivolts / 1000.0;
+#endif
 
     if (battSense) { // Observe battery voltage
-      if (payload.batteryVoltage <= cutoffVoltage) payload.batteryOk = false;
+      if (batteryMillivolts <= cutoffMillivolts) payload.batteryOk = false;
     }
     else { // Observe vcc voltage
-      if (payload.vcc <= cutoffVoltage) payload.batteryOk = false;
+      if (vccMillivolts <= cutoffMillivolts) payload.batteryOk = false;
     }
   }
 }
 
 // Voltage read & averaging subfunctions -----------------------------------------
-// vcc ----
-float vccAverage() {
+// vcc (mV) ----
+unsigned int vccAverage() {
   static int raw[6];
 
   if (raw[0] == 0) {
@@ -945,12 +1224,12 @@ float vccAverage() {
   raw[2] = raw[1];
   raw[1] = raw[0];
   raw[0] = readVcc();
-  float average = (raw[0] + raw[1] + raw[2] + raw[3] + raw[4] + raw[5]) / 6000.0;
+  unsigned int average = ((long)raw[0] + raw[1] + raw[2] + raw[3] + raw[4] + raw[5]) / 6;
   return average;
 }
 
-// battery ----
-float batteryAverage() {
+// battery (mV) ----
+unsigned int batteryAverage() {
   static int raw[6];
 
   if (!battSense) return 0;
@@ -968,7 +1247,7 @@ float batteryAverage() {
   raw[1] = raw[0];
   if (isDriving && HP) raw[0] = (analogRead(BATTERY_DETECT_PIN) + 31); // add 0.3V while driving (HP version only): 1023 steps * 0.3V / 9.9V = 31
   else raw[0] = analogRead(BATTERY_DETECT_PIN); // else take the real voltage (compensates voltage drop while driving)
-  float average = (raw[0] + raw[1] + raw[2] + raw[3] + raw[4] + raw[5]) / 619.999; // 1023steps / 9.9V * 6 = 619.999
+  unsigned int average = ((long)raw[0] + raw[1] + raw[2] + raw[3] + raw[4] + raw[5]) * 1650L / 1023; // 9900mV / 1023steps / 6 = 1650 / 1023
   return average;
 }
 
@@ -978,53 +1257,53 @@ float batteryAverage() {
 // =======================================================================================================
 //
 
-void sendSbusCommands() {
+// 11 bit SBUS value of an axis. The high resolution value is only used, if it still matches the 0 - 100 value
+// (which can be changed by the vehicle functions, for example battery cutoff or MRSC_FIXED)
+uint16_t sbusAxis(byte axis, uint16_t hiRes) {
+  if ((hiRes + 10) / 20 != axis) return readLut(sbusLut, axis);
+  return 172 + ((uint32_t)hiRes * 53707UL >> 16); // 0 - 2000 to 172 - 1811
+}
 
-  static unsigned long lastSbusTime;
-  uint16_t channels[16]; // 0 - 15
+void sendSbusCommands() {
 
   // See: https://github.com/TheDIYGuy999/Rc_Engine_Sound_ESP32
 
+#ifdef UART_TX_INTERRUPT
   if (serialCommands) { // only, if we are in serial command mode
-    if (millis() - lastSbusTime > 14) { // Send the data every 14ms
-      lastSbusTime = millis();
+    if (taskDue(TASK_SERIAL) && !uartBusy()) { // Send the data every 14ms or 7ms (see scheduler.h)
 
-      // Fill SBUS packet with our channels
+      // Update the SBUS frame channels (only changed channels are packed, see sbusFrame.h)
 
       // Proportional channels
-      channels[0] = map(data.axis1, 0, 100, 172, 1811);
+      sbusSetChannel(0, sbusAxis(data.axis1, dataHiRes.axis1));
       if (vehicleType != 1 && vehicleType != 2 && vehicleType != 6) { // Not tracked or half tracked or differential thrust mode
-        channels[1] = map(data.axis2, 0, 100, 172, 1811);
-        channels[2] = map(data.axis3, 0, 100, 172, 1811);
+        sbusSetChannel(1, sbusAxis(data.axis2, dataHiRes.axis2));
+        sbusSetChannel(2, sbusAxis(data.axis3, dataHiRes.axis3));
       }
       else { // tracked or half tracked or differential thrust mode
-        channels[1] = map(lEsc, 0, 100, 172, 1811);
-        channels[2] = map(rEsc, 0, 100, 172, 1811);
+        sbusSetChannel(1, readLut(sbusLut, constrain(lEsc, 0, 100)));
+        sbusSetChannel(2, readLut(sbusLut, constrain(rEsc, 0, 100)));
       }
-      channels[3] = map(data.axis4, 0, 100, 172, 1811);
-      channels[4] = map(data.pot1, 0, 100, 172, 1811);
+      sbusSetChannel(3, sbusAxis(data.axis4, dataHiRes.axis4));
+      sbusSetChannel(4, sbusAxis(data.pot1, dataHiRes.pot1));
 
       // Switches etc.
-      if (data.mode1) channels[5] = 1811; else channels[5] = 172;
-      if (data.mode2) channels[6] = 1811; else channels[6] = 172;
-      if (data.momentary1) channels[7] = 1811; else channels[7] = 172;
-      if (hazard) channels[8] = 1811; else channels[8] = 172;
-      if (left) channels[9] = 1811; else channels[9] = 172;
-      if (right) channels[10] = 1811; else channels[10] = 172;
+      sbusSetChannel(5, sbusSwitch(data.mode1));
+      sbusSetChannel(6, sbusSwitch(data.mode2));
+      sbusSetChannel(7, sbusSwitch(data.momentary1));
+      sbusSetChannel(8, sbusSwitch(hazard));
+      sbusSetChannel(9, sbusSwitch(left));
+      sbusSetChannel(10, sbusSwitch(right));
 
       // Empty channels in neutral position
-      channels[11] = 991;
-      channels[12] = 991;
-      channels[13] = 991;
-      channels[14] = 991;
-      channels[15] = 991;
+      for (byte i = 11; i < 16; i++) sbusSetChannel(i, sbusNeutral);
 
-      // write the SBUS packet
-#ifdef SBUS_SERIAL
-      x8r.write(&channels[0]);
-#endif
+      // send the SBUS frame (interrupt driven)
+      uartSend(sbusFrame, sbusFrameLength);
+      latencyConsumed(LATENCY_SERIAL);
     }
   }
+#endif
 }
 
 //
@@ -1033,17 +1312,39 @@ void sendSbusCommands() {
 // =======================================================================================================
 //
 
+// Binary frame (BINARY_SERIAL option), 9 bytes = 0.8ms @ 115200 baud instead of about 40 bytes ASCII:
+// 0xA5 (start), payload length (6), axis1, axis2, axis3, axis4, pot1 (0 - 100 each),
+// switches (bit 0 = mode1, 1 = mode2, 2 = momentary1, 3 = hazard, 4 = left, 5 = right), CRC-8 of length & payload
+const byte serialFrameStart = 0xA5;
+const byte serialPayloadLength = 6;
+const byte serialFrameLength = serialPayloadLength + 3;
+
 void sendSerialCommands() {
 
-  static unsigned long lastSerialTime;
+  // See: https://github.com/TheDIYGuy999/Rc_Engine_Sound_ESP32
 
+#if defined BINARY_SERIAL && defined UART_TX_INTERRUPT
+  static byte frame[serialFrameLength] = {serialFrameStart, serialPayloadLength};
+
+  if (serialCommands) { // only, if we are in serial command mode
+    if (taskDue(TASK_SERIAL) && !uartBusy()) { // Send the data every 10ms (see scheduler.h)
+      frame[2] = data.axis1;
+      frame[3] = data.axis2;
+      frame[4] = data.axis3;
+      frame[5] = data.axis4;
+      frame[6] = data.pot1;
+      frame[7] = data.mode1 | data.mode2 << 1 | data.momentary1 << 2 | hazard << 3 | left << 4 | right << 5;
+      frame[8] = crc8(&frame[1], serialPayloadLength + 1);
+      uartSend(frame, serialFrameLength); // interrupt driven
+      latencyConsumed(LATENCY_SERIAL);
+    }
+  }
+
+#elif !defined UART_TX_INTERRUPT // ASCII protocol, Serial is used
   // '\n' is used as delimiter (separator of variables) during parsing on the sound controller
   // it is generated by the "println" (print line) command!
-  // See: https://github.com/TheDIYGuy999/Rc_Engine_Sound_ESP32
-
   if (serialCommands) { // only, if we are in serial command mode
-    if (millis() - lastSerialTime > 20) { // Send the data every 20ms
-      lastSerialTime = millis();
+    if (taskDue(TASK_SERIAL)) { // Send the data every 20ms (see scheduler.h)
       Serial.print('<'); // Start marker
       Serial.println(data.axis1);
       Serial.println(data.axis2);
@@ -1057,8 +1358,10 @@ void sendSerialCommands() {
       Serial.println(left);
       Serial.println(right);
       Serial.print('>'); // End marker
+      latencyConsumed(LATENCY_SERIAL);
     }
   }
+#endif
 }
 
 //
@@ -1069,34 +1372,55 @@ void sendSerialCommands() {
 
 void loop() {
 
+  // Start loop stage time measurement
+  stageBegin();
+
+  // Release the periodic tasks, which are due in this pass
+  schedulerUpdate();
+
   // Read radio data from transmitter
   readRadio();
+  stageEnd(STAGE_RADIO);
 
   // Write the servo positions
   writeServos();
+  latencyConsumed(LATENCY_SERVOS);
+  stageEnd(STAGE_SERVOS);
 
   // Drive the motors
-  if (vehicleType == 0) driveMotorsCar(); // Car
-  else if (vehicleType == 5) mrsc(); // Car with MSRC stabilty control
+  if (mrscActive()) mrsc(); // Car with MSRC stabilty control
+  else if (vehicleType == 0 || vehicleType == 5) driveMotorsCar(); // Car (or MRSC car without MPU-6050)
   else if (vehicleType == 3) driveMotorsForklift(); // Forklift
   else if (vehicleType == 4) balancing(); // Self balancing robot
   else driveMotorsSteering(); // Caterpillar and half caterpillar vecicles
+  latencyConsumed(LATENCY_MOTORS);
+  stageEnd(STAGE_DRIVE);
 
   // Battery check
   checkBattery();
+  stageEnd(STAGE_BATTERY);
 
   // Digital Outputs (special functions)
   digitalOutputs();
+  stageEnd(STAGE_OUTPUTS);
 
   // LED
   led();
+  stageEnd(STAGE_LED);
 
   // Send serial commands
 #ifdef SBUS_SERIAL
   // Serial commands are transmitted in SBUS standard
   sendSbusCommands();
 #else
-  // Normal protocol (for ESP32 engine sound controller only)
+  // Binary frame (BINARY_SERIAL) or ASCII protocol (for ESP32 engine sound controller only)
   sendSerialCommands();
 #endif
+  stageEnd(STAGE_SERIAL);
+
+  // Evaluate and print the loop stage times, latencies and task overruns
+  stageReport();
+  latencyReport();
+  profileReport();
+  schedulerReport();
 }
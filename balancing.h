@@ -2,6 +2,7 @@
 #define balancing_h
 
 #include "Arduino.h"
+#include <avr/eeprom.h>
 
 /* This code is based on Joop Brokkings excellent work:
   http://www.brokking.net/imu.html
@@ -16,10 +17,11 @@
 
   -->> Note:
   - The receiver will not work, if vehicleType is set to 4 or 5 and no MPU-6050 sensor is wired up!!
-  - !! Don't move your vehicle during gyro calibration! (about 6s after powering up) !!
+  - !! Don't move your vehicle during gyro calibration! (about 0.3s after powering up, 6s, if there is no valid EEPROM cache) !!
   - The MPU-6050 requires about 20s to stabilize (finding the exact zero point) after powering on!
   - The measurements are taken with 125Hz (8ms) refresh rate. Reason: processing all the code requires up to
     7ms loop time with 8MHz MCU clock. --> You can measure your loop time with loopDuration()
+  - The sensor and PID rates can be changed in scheduler.h (imuRate, anglePidRate, speedPidRate)
 */
 
 //
@@ -31,32 +33,57 @@
 // 6050 variables
 int gyro_x, gyro_y, gyro_z;
 long acc_x_raw, acc_y_raw, acc_z_raw;
-long acc_x, acc_y, acc_z, acc_total_vector;
+long acc_x, acc_y, acc_z;
 int temperature;
 long gyro_x_cal, gyro_y_cal, gyro_z_cal;
 long loop_timer;
-float angle_pitch, angle_roll;
+long angle_pitch_fx, angle_roll_fx;                                    // Q16.16 degrees
 boolean set_gyro_angles;
-float angle_roll_acc, angle_pitch_acc;
+long angle_roll_acc, angle_pitch_acc;                                  // Q16.16 degrees
+long yaw_rate_fx;                                                      // Q16.16 degrees
+float angle_pitch, angle_roll;                                         // Copies of the fixed point values above for the float consumers
 float yaw_rate;
+boolean mrscFallback; // true = no MPU-6050 found, the MRSC vehicle runs as a normal car (STATIC_VEHICLE_CONFIG only)
 
 int speedAveraged;
 int speedPot;
 
-//Define PID Variables
-double speedTarget, speedMeasured, speedOutput;
-double angleTarget, angleMeasured, angleOutput;
-
-double speedAverage;
+//Define PID Variables (Q16.16, see pid.h)
+long speedTarget, speedMeasured, speedOutput;
+long angleTarget, angleMeasured, angleOutput;
+long tiltOffset; // tiltCalibration in Q16.16
 
 // PID controllers (you may have to change their parameters in balancing() )
 //Kp: proportional (instantly), Ki: integral (slow, precise), Kd: deriative (speed of difference)
-PID speedPid(&speedMeasured, &speedOutput, &speedTarget, 0.0, 0.0, 0.0, DIRECT); // Speed: outer, slow control loop
-PID anglePid(&angleMeasured, &angleOutput, &angleTarget, 0.0, 0.0, 0.0, DIRECT); // Angle: inner, fast control loop
+pidController speedPid; // Speed: outer, slow control loop
+pidController anglePid; // Angle: inner, fast control loop
 
 // configuration variables (you may have to change them)
 const int calibrationPasses = 500; // 500 is useful
 
+// MPU-6050 reading (see readMpu6050Data() )
+enum mpuReadStates {
+  MPU_IDLE,
+  MPU_COUNT,
+  MPU_SAMPLES,
+  MPU_RESET
+};
+byte mpuReadState;
+#ifdef MPU6050_FIFO
+const byte mpuFifoBurst = min(4 * imuRate / 125, 8); // Max. number of samples, which are read in one burst (32ms, 16ms at 500Hz)
+// The burst (plus address & register bytes, 9 bit clocks per byte) must be done within the I2C timeout
+static_assert((mpuFifoBurst * 14UL + 4) * 9 * 1000000 / i2cClock < i2cTimeout, "mpuFifoBurst too long for i2cTimeout");
+#else
+const byte mpuFifoBurst = 1;
+#endif
+byte mpuBuffer[mpuFifoBurst * 14];
+unsigned long mpuSampleTime; // micros() of the last sample (not FIFO mode)
+
+// Is the MRSC stability control active? (vehicleType 5 and MPU-6050 found)
+boolean mrscActive() {
+  return vehicleType == 5 && !mrscFallback;
+}
+
 //
 // =======================================================================================================
 // PRINT DEBUG DATA
@@ -74,27 +101,94 @@ void writeDebug() {
     Serial.print("   R: ");
     Serial.print(angle_roll);    //Print roll
     Serial.print("   Motor: ");
-    Serial.println(angleOutput);    //Print Motor output
+    Serial.print(angleOutput / 65536.0);    //Print Motor output
+    Serial.print("   I2C errors: ");
+    Serial.println(i2cErrors);
   }
 #endif
 }
 
+//
+// =======================================================================================================
+// FIXED POINT MATH
+// =======================================================================================================
+//
+
+// The IMU calculations are done in Q16.16 fixed point (degrees * 65536). The ATmega328P has no FPU, so this is a lot
+// faster than the former float multiplications, sqrt() and asin() calls. Angle error against the float version:
+// < 0.01° up to +/-30°, < 0.1° up to +/-85°
+
+// atan(i / 64) in 1/1024 degrees, i = 0 to 64
+const uint16_t atanLut[] PROGMEM = {
+  0, 917, 1833, 2748, 3662, 4574, 5484, 6392, 7296, 8197, 9094, 9986, 10875,
+  11758, 12635, 13507, 14373, 15233, 16086, 16932, 17771, 18602, 19426, 20242, 21049, 21849,
+  22640, 23423, 24196, 24962, 25718, 26465, 27203, 27931, 28651, 29361, 30062, 30754, 31437,
+  32110, 32774, 33428, 34073, 34710, 35337, 35955, 36564, 37164, 37755, 38337, 38911, 39476,
+  40032, 40580, 41120, 41651, 42174, 42690, 43197, 43696, 44188, 44672, 45149, 45618, 46080,
+};
+
+const unsigned long gyroScalePerUs = 67139;                            // 0.0004885 / 8000us in Q16.16 of the Q8.24 gyro scale (degrees per gyro LSB and us)
+const long yawScale = 8196;                                            // 0.0004885 in Q8.24 (yaw_rate is calculated per 8ms step at all IMU rates)
+const long accWeight = 655L * 125 / imuRate;                           // Complementary filter: 655 / 65536 = 0.01 at 125Hz, same time constant at other rates
+
+// Integer square root (rounded down)
+unsigned int isqrt32(unsigned long value) {
+  unsigned long root = 0;
+  unsigned long bit = 1UL << 30;
+
+  while (bit > value) bit >>= 2;
+  while (bit) {
+    if (value >= root + bit) {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else root >>= 1;
+    bit >>= 2;
+  }
+  return root;
+}
+
+// atan() of a Q16 ratio (0 to 65536 = 0 to 1), linear interpolation between the table entries, result in Q16.16 degrees
+long atanQ16(unsigned long ratio) {
+  byte i = ratio >> 10;
+  if (i >= 64) return pgm_read_word(&atanLut[64]) * 64L;
+
+  long a = pgm_read_word(&atanLut[i]);
+  long b = pgm_read_word(&atanLut[i + 1]);
+  return (a * 1024 + (b - a) * (long)(ratio & 1023)) >> 4;
+}
+
+// Angle of the vector (x, y) with x >= 0 (-90° to 90°), in Q16.16 degrees. Equals asin(y / sqrt(x² + y²))
+long angleQ16(long y, unsigned long x) {
+  unsigned long a = y < 0 ? -y : y;
+  long angle;
+
+  if (a == 0 && x == 0) return 0;
+  if (a <= x) angle = atanQ16((a << 16) / x);                         // 0 - 45°
+  else angle = 90L * 65536 - atanQ16((x << 16) / a);                  // 45 - 90°
+  return y < 0 ? -angle : angle;
+}
+
 //
 // =======================================================================================================
 // PROCESS MPU 6050 DATA SUBFUNCTION
 // =======================================================================================================
 //
 
-void processMpu6050Data() {
+// dt = time since the previous sample in us
+void processMpu6050Data(unsigned long dt) {
+  dt = min(dt, 4000000UL / imuRate);                                   // Limit the integration step after a pause (first sample, bus error)
+  long gyroScale = (dt * gyroScalePerUs + 32768) >> 16;                // Q8.24 degrees per gyro LSB (8196 = 0.0004885 at 8000us)
+
   gyro_x -= gyro_x_cal;                                                // Subtract the offset calibration value from the raw gyro_x value
   gyro_y -= gyro_y_cal;                                                // Subtract the offset calibration value from the raw gyro_y value
   gyro_z -= gyro_z_cal;                                                // Subtract the offset calibration value from the raw gyro_z value
 
   //Gyro angle calculations
   //0.0000611 * 4 = 1 / (125Hz / 65.5)
-  angle_pitch += gyro_x * 0.0004885;                                   // Calculate the traveled pitch angle and add this to the angle_pitch variable
-  angle_roll += gyro_y * 0.0004885;                                    // Calculate the traveled roll angle and add this to the angle_roll variable
-  yaw_rate = gyro_z * 0.0004885;                                       // Yaw rate in degrees per second
+  angle_pitch_fx += (gyro_x * gyroScale + 128) >> 8;                   // Calculate the traveled pitch angle and add this to the angle_pitch variable
+  angle_roll_fx += (gyro_y * gyroScale + 128) >> 8;                    // Calculate the traveled roll angle and add this to the angle_roll variable
+  yaw_rate_fx = (gyro_z * yawScale + 128) >> 8;                        // Yaw rate in degrees per second
 
   if (vehicleType == 4) { // Those calculations are only required for the self balancing robot. Otherwise we can save some processing time.
     //0.000001066 = 0.0000611 * (3.142(PI) / 180degr) The Arduino sin function is in radians (not required in this application)
@@ -107,25 +201,27 @@ void processMpu6050Data() {
     acc_z = (acc_z * 9 + acc_z_raw) / 10;
 
     //Accelerometer angle calculations
-    acc_total_vector = sqrt((acc_x * acc_x) + (acc_y * acc_y) + (acc_z * acc_z)); // Calculate the total accelerometer vector
-    //57.296 = 1 / (3.142 / 180) The Arduino asin function is in radians
-    if (abs(acc_y) < acc_total_vector) {                                      //Prevent the asin function to produce a NaN
-      angle_pitch_acc = asin((float)acc_y / acc_total_vector) * 57.296;       //Calculate the pitch angle.
-    }
-    if (abs(acc_x) < acc_total_vector) {                                      //Prevent the asin function to produce a NaN
-      angle_roll_acc = asin((float)acc_x / acc_total_vector) * -57.296;       //Calculate the roll angle.
-    }
+    //asin(acc_y / acc_total_vector) = atan(acc_y / sqrt(acc_x² + acc_z²)), no NaN protection required
+    unsigned long acc_xx = acc_x * acc_x, acc_yy = acc_y * acc_y, acc_zz = acc_z * acc_z;
+    angle_pitch_acc = angleQ16(acc_y, isqrt32(acc_xx + acc_zz));        //Calculate the pitch angle.
+    angle_roll_acc = -angleQ16(acc_x, isqrt32(acc_yy + acc_zz));        //Calculate the roll angle.
 
     if (set_gyro_angles) {                                               // If the IMU is already started (zero drift protection)
-      angle_pitch = angle_pitch * 0.99 + angle_pitch_acc * 0.01;         // Correct the drift of the gyro pitch angle with the accelerometer pitch angle
-      angle_roll = angle_roll * 0.99 + angle_roll_acc * 0.01;            // Correct the drift of the gyro roll angle with the accelerometer roll angle
+      // accWeight / 65536 = 0.01 (the difference is shifted in two steps to prevent an overflow)
+      angle_pitch_fx += ((angle_pitch_acc - angle_pitch_fx) >> 8) * accWeight >> 8; // Correct the drift of the gyro pitch angle with the accelerometer pitch angle
+      angle_roll_fx += ((angle_roll_acc - angle_roll_fx) >> 8) * accWeight >> 8;    // Correct the drift of the gyro roll angle with the accelerometer roll angle
     }
     else {                                                               // At first start
-      angle_pitch = angle_pitch_acc;                                     // Set the gyro pitch angle equals to the accelerometer pitch angle
-      angle_roll = angle_roll_acc;                                       // Set the gyro roll angle equals to the accelerometer roll angle
+      angle_pitch_fx = angle_pitch_acc;                                  // Set the gyro pitch angle equals to the accelerometer pitch angle
+      angle_roll_fx = angle_roll_acc;                                    // Set the gyro roll angle equals to the accelerometer roll angle
       set_gyro_angles = true;                                            // Set the IMU started flag
     }
   }
+
+  // Float copies (1 / 65536 is exact in float)
+  angle_pitch = angle_pitch_fx * (1.0 / 65536);
+  angle_roll = angle_roll_fx * (1.0 / 65536);
+  yaw_rate = yaw_rate_fx * (1.0 / 65536);
 }
 
 //
@@ -134,74 +230,129 @@ void processMpu6050Data() {
 // =======================================================================================================
 //
 
-// Sub function allows setup to call it without delay
-void readMpu6050Raw() {
-  Wire.beginTransmission(0x68);                                        // Start communicating with the MPU-6050
-  Wire.write(0x3B);                                                    // Send the requested starting register
-  Wire.endTransmission();                                              // End the transmission
-  Wire.requestFrom(0x68, 14);                                          // Request 14 bytes from the MPU-6050
-  while (Wire.available() < 14);                                       // Wait until all the bytes are received
-  acc_x_raw = Wire.read() << 8 | Wire.read();                          // Add the low and high byte to the acc_x variable
-  acc_y_raw = Wire.read() << 8 | Wire.read();                          // Add the low and high byte to the acc_y variable
-  acc_z_raw = Wire.read() << 8 | Wire.read();                          // Add the low and high byte to the acc_z variable
-  temperature = Wire.read() << 8 | Wire.read();                        // Add the low and high byte to the temperature variable
-  gyro_x = Wire.read() << 8 | Wire.read();                             // Add the low and high byte to the gyro_x variable
-  gyro_y = Wire.read() << 8 | Wire.read();                             // Add the low and high byte to the gyro_y variable
-  gyro_z = Wire.read() << 8 | Wire.read();                             // Add the low and high byte to the gyro_z variable
+// Convert one 14 byte sample (registers 0x3B - 0x48 or FIFO) to the raw values
+void decodeMpu6050(const byte *data) {
+  acc_x_raw = (int16_t)(data[0] << 8 | data[1]);                       // Add the low and high byte to the acc_x variable
+  acc_y_raw = (int16_t)(data[2] << 8 | data[3]);                       // Add the low and high byte to the acc_y variable
+  acc_z_raw = (int16_t)(data[4] << 8 | data[5]);                       // Add the low and high byte to the acc_z variable
+  temperature = (int16_t)(data[6] << 8 | data[7]);                     // Add the low and high byte to the temperature variable
+  gyro_x = (int16_t)(data[8] << 8 | data[9]);                          // Add the low and high byte to the gyro_x variable
+  gyro_y = (int16_t)(data[10] << 8 | data[11]);                        // Add the low and high byte to the gyro_y variable
+  gyro_z = (int16_t)(data[12] << 8 | data[13]);                        // Add the low and high byte to the gyro_z variable
 }
 
-// Main function
-void readMpu6050Data() {
-  static unsigned long lastReading;
-  if (micros() - lastReading >= 8000) {                                // Read the data every 8000us (equals 125Hz)
-    lastReading = micros();
-
-    readMpu6050Raw();                                                  // Read RAW data
-
-    processMpu6050Data();                                              // Process the MPU 6050 data
-  }
+// Sub function allows setup to call it without delay (blocking)
+void readMpu6050Raw() {
+  if (i2cReadRegisters(0x68, 0x3B, mpuBuffer, 14)) decodeMpu6050(mpuBuffer); // Read 14 bytes, starting with register 0x3B
 }
 
 //
 // =======================================================================================================
-// MPU 6050 SETUP
+// GYRO CALIBRATION & EEPROM CACHE
 // =======================================================================================================
 //
 
-void setupMpu6050() {
+// The gyro offsets are stored in the EEPROM together with the MPU-6050 temperature and a CRC. At power up, a short
+// check (200ms) decides, how the offsets are calibrated:
+// - valid cache, temperature difference < 3°C and the vehicle is moving or the short check confirms them: cache
+// - the vehicle does not move: average of the short check
+// - the vehicle moves and no usable cache: full calibration (about 4s, as before)
+// The cached offsets are corrected with the temperature slopes (see trackGyroBias() ).
+// The offsets are stored once per power cycle after 8s of tracking, one byte per loop pass, so the EEPROM write
+// (3.3ms per byte) does not block the loop.
+
+struct gyroCalibration {
+  byte version;
+  int x, y, z;
+  int temperature; // MPU-6050 raw value (340 per °C)
+  int slopeX, slopeY, slopeZ; // Q8 gyro LSB per °C
+  byte crc;
+};
+
+const byte gyroCacheVersion = 2;
+const int gyroCacheAddress = 0; // EEPROM address
+const int cacheTemperatureTolerance = 1020; // 3°C
+const byte quickCalibrationPasses = 25; // 200ms
+const int quickCalibrationSpread = 50; // max. gyro change during the short check (about 3°/s)
+const int cacheTolerance = 8; // max. difference between the cached offsets and the short check (0.5°/s)
+const int stationaryThreshold = 33; // max. deviation from the offsets while tracking (2°/s)
+
+gyroCalibration gyroCache; // Copy of the EEPROM content
+boolean gyroCacheUsable; // Valid and written at about the same temperature
+boolean gyroCacheSaved; // The refined offsets were stored in this power cycle
+byte gyroCacheWriteIndex = sizeof(gyroCalibration); // Next byte to be written (nothing pending, if sizeof())
+
+// Online bias tracking
+const byte trackingSettle = 64; // stationary samples (0.5s at 125Hz), before the tracking starts
+const byte trackingShift = 9; // tracking time constant 2^9 = 512 samples (4s at 125Hz)
+const int accChangeThreshold = 400; // max. accelerometer change per sample, sum of all axes (about 0.1g)
+const int slopeMinTemperatureDelta = 680; // 2°C min. distance to the reference point, before the slope is estimated
+const int maxSlope = 512; // 2 gyro LSB per °C (datasheet: about 0.7)
+const int maxCompensationDelta = 6800; // The temperature compensation is limited to 20°C
+const unsigned int cacheSaveSamples = 1024; // stationary samples (8s at 125Hz), before the offsets are stored
+
+boolean throttleNeutral = true; // Set by balancing() and mrsc(), the bias is only tracked, if the vehicle is not driven
+long *const gyroCal[3] = {&gyro_x_cal, &gyro_y_cal, &gyro_z_cal};
+long gyroBias[3]; // Q8, tracked offsets at gyroBiasTemperature
+int gyroBiasTemperature;
+long gyroReferenceBias[3]; // Q8, offsets at gyroReferenceTemperature (power up or cache)
+int gyroReferenceTemperature;
+int gyroSlope[3]; // Q8 gyro LSB per °C
+
+boolean readGyroCache() {
+  eeprom_read_block(&gyroCache, (const void *)gyroCacheAddress, sizeof(gyroCache));
+  return gyroCache.version == gyroCacheVersion && crc8((byte *)&gyroCache, offsetof(gyroCalibration, crc)) == gyroCache.crc;
+}
 
-  Wire.begin();                                                        // Start I2C as master
+// Start the background write of the current offsets
+void saveGyroCache() {
+  gyroCache.version = gyroCacheVersion;
+  gyroCache.x = gyro_x_cal;
+  gyroCache.y = gyro_y_cal;
+  gyroCache.z = gyro_z_cal;
+  gyroCache.temperature = temperature;
+  gyroCache.slopeX = gyroSlope[0];
+  gyroCache.slopeY = gyroSlope[1];
+  gyroCache.slopeZ = gyroSlope[2];
+  gyroCache.crc = crc8((byte *)&gyroCache, offsetof(gyroCalibration, crc));
+  gyroCacheWriteIndex = 0;
+}
 
-  // Is an an MPU-6050 (address 0x68) on the I2C bus present?
-  // Allows to use the receiver without an MPU-6050 plugged in (not in balancing mode, vehicleType 4)
-  Wire.beginTransmission(0x68);
-  byte error = Wire.endTransmission();                                 // Read the I2C error byte
-  if (vehicleType == 5 && error > 0) {                                 // If MRSC vehicle (5) is active and there is a bus error
-    vehicleType = 0;                                                   // Fall back to vehicle type 0 (car without MPU-6050)
-    return;                                                            // Cancel the MPU-6050 setup
+// Write one byte, if the EEPROM is ready (called in every loop pass)
+void writeGyroCacheStep() {
+  if (gyroCacheWriteIndex < sizeof(gyroCache) && eeprom_is_ready()) {
+    eeprom_update_byte((byte *)gyroCacheAddress + gyroCacheWriteIndex, ((byte *)&gyroCache)[gyroCacheWriteIndex]);
+    gyroCacheWriteIndex ++;
   }
+}
 
-  // Activate the MPU-6050
-  Wire.beginTransmission(0x68);                                        // Start communicating with the MPU-6050
-  Wire.write(0x6B);                                                    // Send the requested starting register
-  Wire.write(0x00);                                                    // Set the requested starting register
-  Wire.endTransmission();                                              // End the transmission
-  // Configure the accelerometer (+/-8g)
-  Wire.beginTransmission(0x68);                                        // Start communicating with the MPU-6050
-  Wire.write(0x1C);                                                    // Send the requested starting register
-  Wire.write(0x10);                                                    // Set the requested starting register
-  Wire.endTransmission();                                              // End the transmission
-  // Configure the gyro (2000° per second full scale)
-  Wire.beginTransmission(0x68);                                        // Start communicating with the MPU-6050
-  Wire.write(0x1B);                                                    // Send the requested starting register
-  Wire.write(0x18);                                                    // Set the requested starting register
-  Wire.endTransmission();                                              // End the transmission
-
-  // Calibrate the gyro (the vehicle must stay steady during this time!)
-  delay(1500);                                                         // Delay 1.5 seconds to display the text
-#ifdef DEBUG
-  Serial.println("Calibrating gyro");                                  // Print text to console
-#endif
+// Short check at power up, returns true, if the vehicle did not move
+boolean quickGyroCalibration() {
+  int first[3];
+  long sum[3] = {0, 0, 0};
+  boolean steady = true;
+
+  for (byte i = 0; i < quickCalibrationPasses; i++) {
+    delay(8);                                                          // 125Hz
+    readMpu6050Raw();                                                  // Read the raw acc and gyro data from the MPU-6050
+    int gyro[3] = {gyro_x, gyro_y, gyro_z};
+    for (byte axis = 0; axis < 3; axis++) {
+      if (i == 0) first[axis] = gyro[axis];
+      if (abs(gyro[axis] - first[axis]) > quickCalibrationSpread) steady = false;
+      sum[axis] += gyro[axis];
+    }
+  }
+  gyro_x_cal = sum[0] / quickCalibrationPasses;
+  gyro_y_cal = sum[1] / quickCalibrationPasses;
+  gyro_z_cal = sum[2] / quickCalibrationPasses;
+  return steady;
+}
+
+// Full calibration (the vehicle must stay steady during this time!)
+void fullGyroCalibration() {
+  gyro_x_cal = 0;
+  gyro_y_cal = 0;
+  gyro_z_cal = 0;
 
   int cal_int = 0;
   while (cal_int < calibrationPasses) {                                // Run the calibrating code X times
@@ -221,6 +372,224 @@ void setupMpu6050() {
   gyro_x_cal /= calibrationPasses;                                      // Divide the gyro_x_cal variable by X to get the avarage offset
   gyro_y_cal /= calibrationPasses;                                      // Divide the gyro_y_cal variable by X to get the avarage offset
   gyro_z_cal /= calibrationPasses;                                      // Divide the gyro_z_cal variable by X to get the avarage offset
+}
+
+// Start the tracking with the current offsets (after the power up calibration)
+void setupGyroTracking(int referenceTemperature, const int *referenceBias) {
+  for (byte axis = 0; axis < 3; axis++) {
+    gyroBias[axis] = *gyroCal[axis] << 8;
+    gyroReferenceBias[axis] = (long)referenceBias[axis] << 8;
+  }
+  gyroBiasTemperature = temperature;
+  gyroReferenceTemperature = referenceTemperature;
+}
+
+// Online bias tracking & temperature compensation, called with each raw sample. The MPU-6050 offsets drift during
+// the first 20s and with the temperature:
+// - Stationary (throttle neutral, low accelerometer change, low rotation) for 0.5s: the offsets follow the gyro
+//   readings slowly (time constant 4s)
+// - Between the stationary periods, the offsets are corrected with the temperature slopes. They are estimated from
+//   the offset difference to the reference point (power up or cache), if the temperature differs by 2°C or more
+// Budget: a few additions per sample, the compensation every 16 samples and one division every 16 samples
+void trackGyroBias() {
+  static int lastAcc[3];
+  static unsigned int stationaryCount;
+  static byte sampleCount;
+  int gyro[3] = {gyro_x, gyro_y, gyro_z};
+  int acc[3] = {(int)acc_x_raw, (int)acc_y_raw, (int)acc_z_raw};
+
+  // Stationary detection
+  boolean stationary = throttleNeutral;
+  long accChange = 0;
+  for (byte axis = 0; axis < 3; axis++) {
+    accChange += abs((long)acc[axis] - lastAcc[axis]);
+    lastAcc[axis] = acc[axis];
+    if (abs(gyro[axis] - *gyroCal[axis]) > stationaryThreshold) stationary = false;
+  }
+  if (accChange > accChangeThreshold) stationary = false;
+
+  if (!stationary) stationaryCount = 0;
+  else if (stationaryCount < 0xFFFF) stationaryCount ++;
+
+  // Bias tracking
+  if (stationaryCount > trackingSettle) {
+    for (byte axis = 0; axis < 3; axis++) { // rounded, a truncating shift would pull the bias down
+      gyroBias[axis] += (((long)gyro[axis] << 8) - gyroBias[axis] + (1 << (trackingShift - 1))) >> trackingShift;
+    }
+    gyroBiasTemperature = temperature;
+  }
+
+  // Store the offsets once per power cycle, if they have changed
+  if (stationaryCount == cacheSaveSamples && !gyroCacheSaved) {
+    if (!gyroCacheUsable || abs(gyro_x_cal - gyroCache.x) > 1 || abs(gyro_y_cal - gyroCache.y) > 1 || abs(gyro_z_cal - gyroCache.z) > 1
+        || abs(gyroSlope[0] - gyroCache.slopeX) > 4 || abs(gyroSlope[1] - gyroCache.slopeY) > 4 || abs(gyroSlope[2] - gyroCache.slopeZ) > 4) {
+      saveGyroCache();
+      gyroCacheSaved = true;
+    }
+  }
+
+  sampleCount ++;
+  if (sampleCount & 15) return;
+
+  // Temperature slope of one axis per call (after 4s of tracking, far enough from the reference point)
+  byte axis = (sampleCount >> 4) % 3;
+  int referenceDelta = gyroBiasTemperature - gyroReferenceTemperature;
+  if (stationaryCount > trackingSettle + 512 && abs(referenceDelta) >= slopeMinTemperatureDelta) {
+    long estimate = (gyroBias[axis] - gyroReferenceBias[axis]) * 340 / referenceDelta;
+    gyroSlope[axis] += (constrain(estimate, -maxSlope, maxSlope) - gyroSlope[axis]) >> 3;
+  }
+
+  // Temperature compensated offsets (193 / 65536 = 1 / 340)
+  int temperatureDelta = constrain(temperature - gyroBiasTemperature, -maxCompensationDelta, maxCompensationDelta);
+  for (byte i = 0; i < 3; i++) *gyroCal[i] = (gyroBias[i] + ((long)gyroSlope[i] * temperatureDelta * 193 >> 16) + 128) >> 8;
+}
+
+// Main function (non blocking, the I2C transfer is done in the TWI interrupt)
+#ifdef MPU6050_FIFO
+// The MPU-6050 stores its samples (imuRate) in its FIFO. The FIFO byte count is read first, then all the stored samples
+// (up to "mpuFifoBurst") in one burst. Each sample is processed, so a late loop() does not disturb the gyro integration
+void readMpu6050Data() {
+  static const byte countRegister = 0x72;                              // FIFO_COUNT_H
+  static const byte dataRegister = 0x74;                               // FIFO_R_W
+  static const byte reset[] = {0x6A, 0x44};                            // USER_CTRL: FIFO_EN, FIFO_RESET
+  static byte samples;
+
+  writeGyroCacheStep();
+
+  switch (mpuReadState) {
+    case MPU_IDLE:
+      if (taskDue(TASK_IMU)) {                                         // Check the FIFO every 8000us at 125Hz (see scheduler.h)
+        if (i2cStart(0x68, &countRegister, 1, mpuBuffer, 2)) mpuReadState = MPU_COUNT;
+      }
+      break;
+
+    case MPU_COUNT:
+      if (i2cPoll() == I2C_BUSY) break;
+      mpuReadState = MPU_IDLE;
+      if (i2cState == I2C_DONE) {
+        unsigned int count = mpuBuffer[0] << 8 | mpuBuffer[1];
+        if (count % 14 != 0 || count > 1024 - 14) {                    // Misaligned or overflow: start again
+          if (i2cStart(0x68, reset, 2, NULL, 0)) mpuReadState = MPU_RESET;
+        }
+        else {
+          samples = min(count / 14, mpuFifoBurst);
+          if (samples > 0 && i2cStart(0x68, &dataRegister, 1, mpuBuffer, samples * 14)) mpuReadState = MPU_SAMPLES;
+        }
+      }
+      break;
+
+    case MPU_SAMPLES:
+      if (i2cPoll() == I2C_BUSY) break;
+      mpuReadState = MPU_IDLE;
+      if (i2cState == I2C_DONE) {
+        for (byte i = 0; i < samples; i++) {
+          decodeMpu6050(&mpuBuffer[i * 14]);
+          trackGyroBias();
+          profileBegin(PROFILE_MPU_PROCESS);
+          processMpu6050Data(1000000UL / imuRate);                     // Process the MPU 6050 data (sampled with the sensor clock)
+          profileEnd(PROFILE_MPU_PROCESS);
+        }
+      }
+      break;
+
+    case MPU_RESET:
+      if (i2cPoll() != I2C_BUSY) mpuReadState = MPU_IDLE;
+      break;
+  }
+}
+#else
+void readMpu6050Data() {
+  static const byte dataRegister = 0x3B;
+  static unsigned long readTime;
+
+  writeGyroCacheStep();
+
+  if (mpuReadState == MPU_IDLE) {
+    if (taskDue(TASK_IMU)) {                                           // Read the data every 8000us at 125Hz (see scheduler.h)
+      profileBegin(PROFILE_MPU_READ);
+      readTime = micros();
+      if (i2cStart(0x68, &dataRegister, 1, mpuBuffer, 14)) mpuReadState = MPU_SAMPLES; // Request 14 bytes from the MPU-6050
+      profileEnd(PROFILE_MPU_READ);
+    }
+  }
+  else if (i2cPoll() != I2C_BUSY) {                                    // Transfer done (or failed, then try again next time)
+    mpuReadState = MPU_IDLE;
+    if (i2cState == I2C_DONE) {
+      decodeMpu6050(mpuBuffer);
+      trackGyroBias();
+
+      profileBegin(PROFILE_MPU_PROCESS);
+      processMpu6050Data(readTime - mpuSampleTime);                    // Process the MPU 6050 data (measured sample interval)
+      mpuSampleTime = readTime;
+      profileEnd(PROFILE_MPU_PROCESS);
+    }
+  }
+}
+#endif
+
+//
+// =======================================================================================================
+// MPU 6050 SETUP
+// =======================================================================================================
+//
+
+void setupMpu6050() {
+
+  setupI2c();                                                          // Start I2C as master
+
+  // Is an an MPU-6050 (address 0x68) on the I2C bus present?
+  // Allows to use the receiver without an MPU-6050 plugged in (not in balancing mode, vehicleType 4)
+  if (vehicleType == 5 && !i2cProbe(0x68)) {                           // If MRSC vehicle (5) is active and there is a bus error
+#ifdef STATIC_VEHICLE_CONFIG
+    mrscFallback = true;                                               // vehicleType is constant, so use the fallback flag instead
+#else
+    vehicleType = 0;                                                   // Fall back to vehicle type 0 (car without MPU-6050)
+#endif
+    return;                                                            // Cancel the MPU-6050 setup
+  }
+
+  i2cWriteRegister(0x68, 0x6B, 0x00);                                  // Activate the MPU-6050
+  i2cWriteRegister(0x68, 0x1C, 0x10);                                  // Configure the accelerometer (+/-8g)
+  i2cWriteRegister(0x68, 0x1B, 0x18);                                  // Configure the gyro (2000° per second full scale)
+
+  // Calibrate the gyro (see GYRO CALIBRATION & EEPROM CACHE)
+  delay(50);                                                           // Gyro start up time
+  boolean cacheValid = readGyroCache();
+  boolean steady = quickGyroCalibration();
+  gyroCacheUsable = cacheValid && abs(temperature - gyroCache.temperature) < cacheTemperatureTolerance;
+
+  int cacheBias[3] = {gyroCache.x, gyroCache.y, gyroCache.z};
+  if (cacheValid) {                                                    // The slopes are valid at all temperatures
+    int cacheSlope[3] = {gyroCache.slopeX, gyroCache.slopeY, gyroCache.slopeZ};
+    for (byte axis = 0; axis < 3; axis++) gyroSlope[axis] = cacheSlope[axis];
+  }
+  long cacheCorrected[3];                                              // Cached offsets, corrected to the current temperature
+  boolean cacheConfirmed = true;
+  for (byte axis = 0; axis < 3; axis++) {
+    cacheCorrected[axis] = cacheBias[axis] + (((long)gyroSlope[axis] * (temperature - gyroCache.temperature) / 340 + 128) >> 8);
+    if (abs(*gyroCal[axis] - cacheCorrected[axis]) > cacheTolerance) cacheConfirmed = false;
+  }
+
+  if (gyroCacheUsable && (!steady || cacheConfirmed)) {
+    for (byte axis = 0; axis < 3; axis++) *gyroCal[axis] = cacheCorrected[axis]; // Use the cached offsets
+    setupGyroTracking(gyroCache.temperature, cacheBias);
+#ifdef DEBUG
+    Serial.println("Gyro calibration from EEPROM");
+#endif
+  }
+  else {
+    if (!steady) {                                                     // Moving and no usable cache: full calibration
+#ifdef DEBUG
+      Serial.println("Calibrating gyro");                              // Print text to console
+#endif
+      fullGyroCalibration();                                           // Not cached, the tracking stores it, as soon as the vehicle is stationary
+    }
+#ifdef DEBUG
+    else Serial.println("Gyro calibration from short check");
+#endif
+    int bias[3] = {(int)gyro_x_cal, (int)gyro_y_cal, (int)gyro_z_cal};
+    setupGyroTracking(temperature, bias);
+  }
 
 #ifdef DEBUG
 
@@ -233,6 +602,12 @@ void setupMpu6050() {
 
   Serial.println("done!");
 #endif
+
+#ifdef MPU6050_FIFO
+  i2cWriteRegister(0x68, 0x19, 8000 / imuRate - 1);                    // Sample rate 8kHz / (1 + 63) = 125Hz
+  i2cWriteRegister(0x68, 0x23, 0xF8);                                  // Write temperature, gyro and accelerometer data to the FIFO
+  i2cWriteRegister(0x68, 0x6A, 0x44);                                  // Enable and reset the FIFO
+#endif
 }
 
 //
@@ -243,15 +618,13 @@ void setupMpu6050() {
 
 void setupPid() {
 
-  // Speed control loop
-  speedPid.SetSampleTime(8); // calcualte every 4ms = 250Hz
-  speedPid.SetOutputLimits(-33, 33); // output range from -33 to 33 (same as in balancing() )
-  speedPid.SetMode(AUTOMATIC);
+  // Speed control loop (calculated every 8ms = 125Hz, see speedPidRate in scheduler.h)
+  pidSetOutputLimits(speedPid, -33, 33); // output range from -33 to 33 (same as in balancing() )
+
+  // Angle control loop (calculated every 8ms = 125Hz, see anglePidRate in scheduler.h)
+  pidSetOutputLimits(anglePid, -43, 43); // output range from -43 to 43 for motor
 
-  // Angle control loop
-  anglePid.SetSampleTime(8); // calcualte every 4ms = 250Hz
-  anglePid.SetOutputLimits(-43, 43); // output range from -43 to 43 for motor
-  anglePid.SetMode(AUTOMATIC);
+  tiltOffset = tiltCalibration * 65536;
 }
 
 #endif
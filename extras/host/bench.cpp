@@ -0,0 +1,60 @@
+//
+// =======================================================================================================
+// LOOP STAGE BENCHMARK
+// =======================================================================================================
+//
+
+// Runs one vehicle configuration for a simulated time (like the runner) and prints the median and the 99th percentile
+// of the host CPU time of each loop() stage in ns (the max. would only show the host scheduler). The sketch is
+// compiled with STAGE_TIMING and the host CPU clock (see helper.h). The time of the simulated peripherals and
+// interrupts is not included. The host is much faster than the ATmega328P, so the values are only comparable with each
+// other (between stages, configurations and commits), not with the 8ms deadline. Use the measurement on the target
+// (STAGE_TIMING & DEBUG) for that.
+// Usage: bench_<CONFIG> [--header] [seconds]
+
+#include "sketch.cpp"
+
+const char *stageNames[STAGE_COUNT] = {"radio", "servos", "drive", "battery", "outputs", "led", "serial"};
+
+int main(int argc, char **argv) {
+  if (argc > 1 && !strcmp(argv[1], "--header")) {
+    printf("%-28s %4s %13s", "configuration", "type", "loop med/p99");
+    for (byte i = 0; i < STAGE_COUNT; i++) printf(" %13s", stageNames[i]);
+    printf("\n");
+    argc--;
+    argv++;
+  }
+  uint32_t seconds = argc > 1 ? atoi(argv[1]) : 10;
+
+  hostTransmitter.enabled = true;
+  setup();
+  uint32_t setupTime = hostNow();
+
+  std::vector<uint32_t> durations[STAGE_COUNT + 1]; // Stages and the whole loop
+
+  while (hostNow() - setupTime < seconds * 1000000UL) {
+    unsigned long before[STAGE_COUNT];
+    memcpy(before, stageSum, sizeof(before));
+    unsigned int count = loopCount;
+    loop();
+    hostAdvance(500);
+    if (loopCount != count + 1) continue; // The statistics were reset by stageReport()
+
+    uint32_t total = 0;
+    for (byte i = 0; i < STAGE_COUNT; i++) {
+      uint32_t duration = stageSum[i] - before[i];
+      durations[i].push_back(duration);
+      total += duration;
+    }
+    durations[STAGE_COUNT].push_back(total);
+  }
+
+  printf("%-28s %4u", BENCH_NAME, vehicleType);
+  for (byte i = 0; i <= STAGE_COUNT; i++) {
+    std::vector<uint32_t> &d = durations[(i + STAGE_COUNT) % (STAGE_COUNT + 1)]; // Loop first
+    std::sort(d.begin(), d.end());
+    printf(" %6u/%6u", d[d.size() / 2], d[d.size() * 99 / 100]);
+  }
+  printf("\n");
+  return 0;
+}
@@ -0,0 +1,279 @@
+#ifndef Arduino_h
+#define Arduino_h
+
+//
+// =======================================================================================================
+// HOST STUB OF THE ARDUINO CORE (ATmega328P @ 8MHz)
+// =======================================================================================================
+//
+
+// The sketch is compiled unchanged against this header. The AVR registers are objects, which call the simulated
+// peripherals in hal.cpp (Timer 1, TWI, UART, ADC, ports). The interrupt vectors are normal functions, which are
+// called by the simulation, as soon as their flag is set and the interrupts are enabled.
+// Time is simulated: it only advances with delay(), delayMicroseconds(), micros() calls (1us each) and hostAdvance().
+
+// All standard headers, which are used by the harness, are included before the "long" macro at the end
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef F_CPU
+#define F_CPU 8000000UL
+#endif
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+//
+// =======================================================================================================
+// REGISTERS
+// =======================================================================================================
+//
+
+enum hostRegisterId {
+  REG_PORTB, REG_PORTC, REG_PORTD, REG_DDRB, REG_DDRC, REG_DDRD, REG_PINC,
+  REG_TCCR1A, REG_TCCR1B, REG_TIMSK1, REG_TIFR1, REG_OCR1A, REG_OCR1B, REG_TCNT1, REG_ICR1,
+  REG_TCCR2A, REG_TCCR2B, REG_TIMSK2, REG_OCR2A, REG_OCR2B,
+  REG_TWCR, REG_TWDR, REG_TWSR, REG_TWBR,
+  REG_UCSR0A, REG_UCSR0B, REG_UCSR0C, REG_UDR0, REG_UBRR0,
+  REG_ADMUX, REG_ADCSRA, REG_ADCL, REG_ADCH,
+  REG_EIMSK, REG_EICRA, REG_SREG
+};
+
+// Read and write hooks of the simulated peripherals (hal.cpp)
+unsigned int hostRegisterRead(byte id, unsigned int value);
+void hostRegisterWrite(byte id, unsigned int oldValue);
+
+template <typename T> struct hostRegister {
+  T value;
+  byte id;
+
+  operator T() const { return hostRegisterRead(id, value); }
+  hostRegister &operator=(T v) { T old = value; value = v; hostRegisterWrite(id, old); return *this; }
+  hostRegister &operator|=(unsigned int v) { return *this = (T)(T(*this) | v); } // Masks like ~_BV(b) are int
+  hostRegister &operator&=(unsigned int v) { return *this = (T)(T(*this) & v); }
+  hostRegister &operator^=(unsigned int v) { return *this = (T)(T(*this) ^ v); }
+};
+
+typedef hostRegister<uint8_t> hostRegister8;
+typedef hostRegister<uint16_t> hostRegister16;
+
+extern hostRegister8 PORTB, PORTC, PORTD, DDRB, DDRC, DDRD, PINC;
+extern hostRegister8 TCCR1A, TCCR1B, TIMSK1, TIFR1;
+extern hostRegister16 OCR1A, OCR1B, TCNT1, ICR1;
+extern hostRegister8 TCCR2A, TCCR2B, TIMSK2, OCR2A, OCR2B;
+extern hostRegister8 TWCR, TWDR, TWSR, TWBR;
+extern hostRegister8 UCSR0A, UCSR0B, UCSR0C, UDR0;
+extern hostRegister16 UBRR0;
+extern hostRegister8 ADMUX, ADCSRA, ADCL, ADCH;
+extern hostRegister8 EIMSK, EICRA, SREG;
+
+#define _BV(b) (1u << (b))
+#define bit_is_set(r, b) ((r) & _BV(b))
+#define bit_is_clear(r, b) (!((r) & _BV(b)))
+
+// Timer 1
+#define WGM12 3
+#define WGM13 4
+#define CS10 0
+#define CS11 1
+#define CS12 2
+#define TOIE1 0
+#define OCIE1A 1
+#define OCIE1B 2
+#define ICIE1 5
+#define TOV1 0
+#define OCF1A 1
+#define OCF1B 2
+#define ICF1 5
+
+// TWI
+#define TWIE 0
+#define TWEN 2
+#define TWWC 3
+#define TWSTO 4
+#define TWSTA 5
+#define TWEA 6
+#define TWINT 7
+
+// UART
+#define MPCM0 0
+#define U2X0 1
+#define UDRE0 5
+#define TXC0 6
+#define UCSZ00 1
+#define UCSZ01 2
+#define USBS0 3
+#define UPM00 4
+#define UPM01 5
+#define TXEN0 3
+#define RXEN0 4
+#define UDRIE0 5
+#define TXCIE0 6
+#define RXCIE0 7
+
+// ADC
+#define MUX0 0
+#define MUX1 1
+#define MUX2 2
+#define MUX3 3
+#define MUX4 4
+#define MUX5 5
+#define REFS0 6
+#define REFS1 7
+#define ADSC 6
+#define ADEN 7
+
+// SREG
+#define SREG_I 7
+
+//
+// =======================================================================================================
+// INTERRUPTS
+// =======================================================================================================
+//
+
+// The vectors are plain C functions. The simulation calls them through weak references (see hal.cpp)
+#define ISR(vector, ...) extern "C" void vector(void)
+#define ISR_NOBLOCK
+#define ISR_BLOCK
+
+void cli();
+void sei();
+#define noInterrupts() cli()
+#define interrupts() sei()
+
+#define digitalPinToInterrupt(p) ((p) == 2 ? 0 : ((p) == 3 ? 1 : -1))
+#define LOW 0
+#define HIGH 1
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+void attachInterrupt(uint8_t interruptNumber, void (*handler)(), int mode);
+void detachInterrupt(uint8_t interruptNumber);
+
+//
+// =======================================================================================================
+// PINS, TIME & MATH
+// =======================================================================================================
+//
+
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define A6 20
+#define A7 21
+#define SDA 18
+#define SCL 19
+
+#define DEC 10
+#define HEX 16
+#define BIN 2
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+void tone(uint8_t pin, unsigned int frequency, uint32_t duration = 0);
+void noTone(uint8_t pin);
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(unsigned int us);
+
+int32_t random(int32_t howBig);
+int32_t random(int32_t howSmall, int32_t howBig);
+void randomSeed(uint32_t seed);
+int32_t map(int32_t x, int32_t inMin, int32_t inMax, int32_t outMin, int32_t outMax);
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define abs(x) ((x) > 0 ? (x) : -(x))
+
+//
+// =======================================================================================================
+// PROGMEM
+// =======================================================================================================
+//
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define pgm_read_ptr(p) (*(void *const *)(p))
+#define memcpy_P memcpy
+
+//
+// =======================================================================================================
+// SERIAL (THE OUTPUT IS COLLECTED IN "output")
+// =======================================================================================================
+//
+
+struct HardwareSerial {
+  std::string output;
+  boolean echo; // Copy the output to stdout
+
+  void begin(uint32_t baud, byte config = 0) {}
+  void end() {}
+  void flush() {}
+  int available() { return 0; }
+  int read() { return -1; }
+  int availableForWrite() { return 63; }
+
+  size_t write(uint8_t c) { output += (char)c; if (echo) putchar(c); return 1; }
+  size_t write(const uint8_t *buffer, size_t size) { for (size_t i = 0; i < size; i++) write(buffer[i]); return size; }
+  size_t print(const std::string &s) { write((const uint8_t *)s.data(), s.size()); return s.size(); }
+
+  size_t print(const char *s) { return print(std::string(s)); }
+  size_t print(char c) { return write(c); }
+  size_t print(float value, int digits = 2) { return print((double)value, digits); }
+  size_t print(double value, int digits = 2) { std::ostringstream o; o.setf(std::ios::fixed); o.precision(digits); o << value; return print(o.str()); }
+  template <typename T> size_t print(T value, int base = DEC) {
+    std::ostringstream o;
+    if (base == HEX) o << std::hex;
+    o << +value; // Integer promotion, so bytes are printed as numbers
+    return print(o.str());
+  }
+
+  size_t println() { return print("\r\n"); }
+  template <typename T> size_t println(T value) { return print(value) + println(); }
+  template <typename T> size_t println(T value, int format) { return print(value, format) + println(); }
+};
+
+extern HardwareSerial Serial;
+
+//
+// =======================================================================================================
+// AVR DATA TYPES
+// =======================================================================================================
+//
+
+// "long" is 32 bit on the AVR, so the Q16.16 fixed point math overflows like on the target. Note, that "int" is
+// still 32 bit (16 bit on the AVR). Include all further standard headers before this header.
+#define long int
+
+#endif
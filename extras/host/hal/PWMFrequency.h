@@ -0,0 +1,8 @@
+#ifndef PWMFrequency_h
+#define PWMFrequency_h
+
+#include "Arduino.h"
+
+inline void setPWMPrescaler(uint8_t pin, uint16_t prescaler) {}
+
+#endif
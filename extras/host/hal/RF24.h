@@ -0,0 +1,84 @@
+#ifndef RF24_h
+#define RF24_h
+
+#include "host.h"
+
+//
+// =======================================================================================================
+// HOST STUB OF THE RF24 LIBRARY (NRF24L01 MODEL, SEE hal.cpp)
+// =======================================================================================================
+//
+
+// Each call, which is an SPI transaction on the real radio, is counted and takes some simulated time
+
+typedef enum { RF24_PA_MIN = 0, RF24_PA_LOW, RF24_PA_HIGH, RF24_PA_MAX, RF24_PA_ERROR } rf24_pa_dbm_e;
+typedef enum { RF24_1MBPS = 0, RF24_2MBPS, RF24_250KBPS } rf24_datarate_e;
+typedef enum { RF24_CRC_DISABLED = 0, RF24_CRC_8, RF24_CRC_16 } rf24_crclength_e;
+
+void hostRadioSpi(byte bytes);
+void hostRadioClearIrq();
+
+class RF24 {
+  public:
+    RF24(uint16_t cePin, uint16_t csPin) {}
+
+    bool begin() {
+      delay(5); // Power on reset
+      hostRadioSpi(32);
+      hostRadio.listening = false;
+      hostRadio.rxFifo.clear();
+      hostRadioClearIrq();
+      return true;
+    }
+    void setChannel(uint8_t channel) { hostRadioSpi(2); hostRadio.channel = channel; }
+    uint8_t getChannel() { hostRadioSpi(2); return hostRadio.channel; }
+    void setPALevel(uint8_t level) { hostRadioSpi(4); }
+    bool setDataRate(rf24_datarate_e speed) { hostRadioSpi(4); return true; }
+    void setCRCLength(rf24_crclength_e length) { hostRadioSpi(4); }
+    void setAutoAck(bool enable) { hostRadioSpi(2); }
+    void setAutoAck(uint8_t pipe, bool enable) { hostRadioSpi(4); }
+    void enableAckPayload() { hostRadioSpi(4); }
+    void enableDynamicPayloads() { hostRadioSpi(4); }
+    void setRetries(uint8_t delay, uint8_t count) { hostRadioSpi(2); }
+    void openReadingPipe(uint8_t number, uint64_t address) { hostRadioSpi(10); }
+    void startListening() { hostRadioSpi(4); hostRadio.listening = true; }
+    void stopListening() { hostRadioSpi(4); hostRadio.listening = false; }
+    void maskIRQ(bool txOk, bool txFail, bool rxReady) { hostRadioSpi(4); hostRadio.rxMasked = rxReady; }
+    void printDetails() { Serial.println("NRF24L01 (host model)"); }
+
+    bool available() {
+      return available(NULL);
+    }
+    bool available(uint8_t *pipe) {
+      hostRadioSpi(2);
+      if (hostRadio.rxFifo.empty()) return false;
+      if (pipe) *pipe = 1;
+      return true;
+    }
+    uint8_t getDynamicPayloadSize() {
+      hostRadioSpi(2);
+      return hostRadio.rxFifo.empty() ? 0 : hostRadio.rxFifo.front().size();
+    }
+    void read(void *buffer, uint8_t length) {
+      hostRadioSpi(length + 1);
+      if (hostRadio.rxFifo.empty()) return;
+      std::vector<byte> &packet = hostRadio.rxFifo.front();
+      memset(buffer, 0, length);
+      memcpy(buffer, packet.data(), std::min<size_t>(length, packet.size()));
+      hostRadio.rxFifo.pop_front();
+    }
+    void writeAckPayload(uint8_t pipe, const void *buffer, uint8_t length) {
+      hostRadioSpi(length + 1);
+      hostRadio.ackPayload.assign((const byte *)buffer, (const byte *)buffer + length);
+    }
+    void whatHappened(bool &txOk, bool &txFail, bool &rxReady) {
+      hostRadioSpi(2);
+      txOk = txFail = false;
+      rxReady = hostRadio.rxReady;
+      hostRadioClearIrq();
+    }
+    bool testRPD() { hostRadioSpi(2); return false; }
+    void flush_rx() { hostRadioSpi(1); hostRadio.rxFifo.clear(); }
+};
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef TB6612FNG_h
+#define TB6612FNG_h
+
+#include "host.h"
+
+//
+// =======================================================================================================
+// HOST STUB OF THE TB6612FNG LIBRARY
+// =======================================================================================================
+//
+
+// Records the drive() calls in hostMotor[] (in the order of the begin() calls). No internal ramp, so
+// brakeActive() is always false. begin() makes the pins outputs, like the library.
+
+class TB6612FNG {
+  public:
+    void begin(int in1, int in2, int pwm, int minInput, int maxInput, int neutralWidth, boolean invert) {
+      static byte count;
+      motor = &hostMotor[count++ % 2];
+      neutral = (minInput + maxInput) / 2;
+      width = neutralWidth;
+      pinMode(in1, OUTPUT);
+      pinMode(in2, OUTPUT);
+      pinMode(pwm, OUTPUT);
+    }
+
+    // Returns true, if the motor is driving (not in the neutral zone)
+    boolean drive(int controlValue, int minPWM, int maxPWM, int rampTime, boolean neutralBrake) {
+      if (!motor) return false;
+      motor->input = controlValue;
+      motor->minPwm = minPWM;
+      motor->maxPwm = maxPWM;
+      motor->calls++;
+      return controlValue < neutral - width || controlValue > neutral + width;
+    }
+
+    boolean brakeActive() {
+      return false;
+    }
+
+  private:
+    hostMotorState *motor = nullptr;
+    int neutral = 50;
+    int width = 4;
+};
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef eeprom_h
+#define eeprom_h
+
+#include "host.h"
+
+// The EEPROM content is hostEeprom[]. Writes take no time
+
+inline bool eeprom_is_ready() {
+  return true;
+}
+
+inline uint8_t eeprom_read_byte(const uint8_t *address) {
+  return hostEeprom[(size_t)address % sizeof(hostEeprom)];
+}
+
+inline void eeprom_update_byte(uint8_t *address, uint8_t value) {
+  hostEeprom[(size_t)address % sizeof(hostEeprom)] = value;
+}
+
+inline void eeprom_read_block(void *destination, const void *source, size_t length) {
+  for (size_t i = 0; i < length; i++) ((uint8_t *)destination)[i] = eeprom_read_byte((const uint8_t *)source + i);
+}
+
+#endif
@@ -0,0 +1,668 @@
+#include <chrono>
+#include "host.h"
+#include <util/twi.h>
+
+//
+// =======================================================================================================
+// HOST SIMULATION OF THE ATMEGA328P PERIPHERALS, THE MPU-6050 AND THE NRF24L01
+// =======================================================================================================
+//
+
+// Only the parts, which are used by the sketch, are simulated:
+// - Timer 1 in CTC mode 12 (TOP = ICR1) with the capture, compare A and compare B interrupts
+// - TWI master with the MPU-6050 as the only slave (registers, sensor data and FIFO)
+// - UART transmitter with the data register empty interrupt
+// - ADC (battery voltage and the internal 1.1V reference), ports, external interrupts
+// Each simulated microsecond, the peripherals are stepped and the pending interrupts are called.
+
+// Interrupt vectors of the sketch (weak, not all of them exist in every configuration)
+extern "C" void TIMER1_CAPT_vect(void) __attribute__((weak));
+extern "C" void TIMER1_COMPA_vect(void) __attribute__((weak));
+extern "C" void TIMER1_COMPB_vect(void) __attribute__((weak));
+extern "C" void TWI_vect(void) __attribute__((weak));
+extern "C" void USART_UDRE_vect(void) __attribute__((weak));
+
+hostRegister8 PORTB = {0, REG_PORTB}, PORTC = {0, REG_PORTC}, PORTD = {0, REG_PORTD};
+hostRegister8 DDRB = {0, REG_DDRB}, DDRC = {0, REG_DDRC}, DDRD = {0, REG_DDRD}, PINC = {0, REG_PINC};
+hostRegister8 TCCR1A = {0, REG_TCCR1A}, TCCR1B = {0, REG_TCCR1B}, TIMSK1 = {0, REG_TIMSK1}, TIFR1 = {0, REG_TIFR1};
+hostRegister16 OCR1A = {0, REG_OCR1A}, OCR1B = {0, REG_OCR1B}, TCNT1 = {0, REG_TCNT1}, ICR1 = {0, REG_ICR1};
+hostRegister8 TCCR2A = {0, REG_TCCR2A}, TCCR2B = {0, REG_TCCR2B}, TIMSK2 = {0, REG_TIMSK2};
+hostRegister8 OCR2A = {0, REG_OCR2A}, OCR2B = {0, REG_OCR2B};
+hostRegister8 TWCR = {0, REG_TWCR}, TWDR = {0xFF, REG_TWDR}, TWSR = {0xF8, REG_TWSR}, TWBR = {0, REG_TWBR};
+hostRegister8 UCSR0A = {_BV(UDRE0), REG_UCSR0A}, UCSR0B = {0, REG_UCSR0B}, UCSR0C = {_BV(UCSZ01) | _BV(UCSZ00), REG_UCSR0C};
+hostRegister8 UDR0 = {0, REG_UDR0};
+hostRegister16 UBRR0 = {0, REG_UBRR0};
+hostRegister8 ADMUX = {0, REG_ADMUX}, ADCSRA = {0, REG_ADCSRA}, ADCL = {0, REG_ADCL}, ADCH = {0, REG_ADCH};
+hostRegister8 EIMSK = {0, REG_EIMSK}, EICRA = {0, REG_EICRA}, SREG = {0, REG_SREG};
+
+HardwareSerial Serial;
+
+uint32_t hostMicrosCost = 1;
+boolean hostInterruptsEnabled = true;
+boolean hostInIsr;
+uint32_t hostIsrCalls[4];
+std::function<void(char port, byte oldValue, byte newValue)> hostPortChanged;
+int hostAnalogValue[8] = {512, 512, 512, 512, 512, 512, 512, 765}; // A7: 7.4V battery (20k / 10k divider)
+uint32_t hostVccMillivolts = 3300;
+std::vector<byte> hostUartOutput;
+hostMpuModel hostMpu;
+uint32_t hostTwiBytes;
+hostRadioModel hostRadio;
+hostTransmitterModel hostTransmitter;
+hostMotorState hostMotor[2];
+byte hostEeprom[1024];
+
+static uint32_t simTime; // us
+static uint64_t simulationNanos; // Host time, which was spent in hostAdvance()
+
+static void stepPeripherals();
+static void dispatchInterrupts();
+
+//
+// =======================================================================================================
+// TIME
+// =======================================================================================================
+//
+
+static uint64_t hostNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void hostAdvance(uint32_t us) {
+  static byte depth; // Interrupts can call micros()
+  uint64_t start = depth++ == 0 ? hostNanos() : 0;
+  while (us--) {
+    simTime++;
+    stepPeripherals();
+    dispatchInterrupts();
+  }
+  if (--depth == 0) simulationNanos += hostNanos() - start;
+}
+
+uint32_t hostCpuNanos() {
+  return hostNanos() - simulationNanos;
+}
+
+uint32_t hostNow() {
+  return simTime;
+}
+
+uint32_t micros() {
+  hostAdvance(hostMicrosCost);
+  return simTime;
+}
+
+uint32_t millis() {
+  return micros() / 1000;
+}
+
+void delay(uint32_t ms) {
+  hostAdvance(ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us) {
+  hostAdvance(us);
+}
+
+//
+// =======================================================================================================
+// INTERRUPTS
+// =======================================================================================================
+//
+
+static void (*extHandler[2])();
+static boolean extPending[2];
+static boolean irqLevel = HIGH;
+
+void cli() {
+  hostInterruptsEnabled = false;
+}
+
+void sei() {
+  hostInterruptsEnabled = true;
+  dispatchInterrupts();
+}
+
+void attachInterrupt(uint8_t interruptNumber, void (*handler)(), int mode) {
+  if (interruptNumber > 1) return;
+  extHandler[interruptNumber] = handler; // Falling edge only (the NRF24 IRQ)
+  EIMSK.value |= _BV(interruptNumber);
+}
+
+void detachInterrupt(uint8_t interruptNumber) {
+  if (interruptNumber > 1) return;
+  EIMSK.value &= ~_BV(interruptNumber); // A pending flag stays set, like on the AVR
+}
+
+static void callVector(void (*vector)(), byte counter) {
+  hostInIsr = true;
+  hostInterruptsEnabled = false;
+  if (counter < 4) hostIsrCalls[counter]++;
+  vector();
+  hostInterruptsEnabled = true;
+  hostInIsr = false;
+}
+
+static boolean uartDataEmpty();
+
+// Calls the pending interrupts in the order of their vector numbers (priority)
+static void dispatchInterrupts() {
+  if (!hostInterruptsEnabled || hostInIsr) return;
+  for (;;) {
+    if (extPending[0] && (EIMSK.value & 1) && extHandler[0]) {
+      extPending[0] = false;
+      callVector(extHandler[0], 3);
+    }
+    else if (extPending[1] && (EIMSK.value & 2) && extHandler[1]) {
+      extPending[1] = false;
+      callVector(extHandler[1], 3);
+    }
+    else if ((TIFR1.value & _BV(ICF1)) && (TIMSK1.value & _BV(ICIE1)) && TIMER1_CAPT_vect) {
+      TIFR1.value &= ~_BV(ICF1);
+      callVector(TIMER1_CAPT_vect, 0);
+    }
+    else if ((TIFR1.value & _BV(OCF1A)) && (TIMSK1.value & _BV(OCIE1A)) && TIMER1_COMPA_vect) {
+      TIFR1.value &= ~_BV(OCF1A);
+      callVector(TIMER1_COMPA_vect, 1);
+    }
+    else if ((TIFR1.value & _BV(OCF1B)) && (TIMSK1.value & _BV(OCIE1B)) && TIMER1_COMPB_vect) {
+      TIFR1.value &= ~_BV(OCF1B);
+      callVector(TIMER1_COMPB_vect, 2);
+    }
+    else if ((UCSR0B.value & _BV(UDRIE0)) && uartDataEmpty() && USART_UDRE_vect) {
+      callVector(USART_UDRE_vect, 4); // Level triggered, the vector must write UDR0 or disable the interrupt
+    }
+    else if ((TWCR.value & _BV(TWINT)) && (TWCR.value & _BV(TWIE)) && (TWCR.value & _BV(TWEN)) && TWI_vect) {
+      callVector(TWI_vect, 4); // Level triggered, until TWINT is cleared
+    }
+    else break;
+  }
+}
+
+//
+// =======================================================================================================
+// PINS & ADC
+// =======================================================================================================
+//
+
+static hostRegister8 *pinPort(uint8_t pin, byte &bit) {
+  if (pin < 8) {
+    bit = pin;
+    return &PORTD;
+  }
+  if (pin < 14) {
+    bit = pin - 8;
+    return &PORTB;
+  }
+  bit = pin - A0;
+  return pin <= A5 ? &PORTC : NULL;
+}
+
+static hostRegister8 *pinDdr(uint8_t pin) {
+  if (pin < 8) return &DDRD;
+  if (pin < 14) return &DDRB;
+  return pin <= A5 ? &DDRC : NULL;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  byte bit;
+  hostRegister8 *port = pinPort(pin, bit);
+  hostRegister8 *ddr = pinDdr(pin);
+  if (!port) return;
+  if (mode == OUTPUT) *ddr |= _BV(bit);
+  else {
+    *ddr &= ~_BV(bit);
+    if (mode == INPUT_PULLUP) *port |= _BV(bit);
+    else *port &= ~_BV(bit);
+  }
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  byte bit;
+  hostRegister8 *port = pinPort(pin, bit);
+  if (!port) return;
+  if (value) *port |= _BV(bit);
+  else *port &= ~_BV(bit);
+}
+
+int digitalRead(uint8_t pin) {
+  if (hostRadio.irqPin && pin == hostRadio.irqPin) return irqLevel;
+  byte bit;
+  hostRegister8 *port = pinPort(pin, bit);
+  if (!port) return LOW;
+  if (!(pinDdr(pin)->value & _BV(bit)) && (pin == SDA || pin == SCL)) return HIGH; // I2C bus idle (pullups)
+  return (port->value >> bit) & 1;
+}
+
+static int adcValue(byte mux) {
+  if (mux == 0x0E) return 1125300UL / hostVccMillivolts; // Internal 1.1V reference, measured against Vcc
+  return mux < 8 ? hostAnalogValue[mux] : 0;
+}
+
+int analogRead(uint8_t pin) {
+  if (pin >= A0) pin -= A0;
+  return pin < 8 ? hostAnalogValue[pin] : 0;
+}
+
+void analogWrite(uint8_t pin, int value) {}
+void tone(uint8_t pin, unsigned int frequency, uint32_t duration) {}
+void noTone(uint8_t pin) {}
+
+static std::mt19937 randomGenerator(1);
+
+int32_t random(int32_t howBig) {
+  return howBig > 0 ? randomGenerator() % howBig : 0;
+}
+
+int32_t random(int32_t howSmall, int32_t howBig) {
+  return howSmall >= howBig ? howSmall : howSmall + random(howBig - howSmall);
+}
+
+void randomSeed(uint32_t seed) {
+  randomGenerator.seed(seed);
+}
+
+int32_t map(int32_t x, int32_t inMin, int32_t inMax, int32_t outMin, int32_t outMax) {
+  return (int64_t)(x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+//
+// =======================================================================================================
+// MPU-6050
+// =======================================================================================================
+//
+
+static const byte mpuAddress = 0x68;
+
+static hostMpuSample defaultMpuSample(uint32_t time) {
+  hostMpuSample s = {{0, 0, 4096}, -1360, {20, -15, 8}}; // Level, 32.5°C, small gyro offsets
+  return s;
+}
+
+static void mpuSampleBytes(byte *data) {
+  hostMpuSample s = hostMpu.sample ? hostMpu.sample(simTime) : defaultMpuSample(simTime);
+  int16_t words[7] = {s.acc[0], s.acc[1], s.acc[2], s.temperature, s.gyro[0], s.gyro[1], s.gyro[2]};
+  for (byte i = 0; i < 7; i++) {
+    data[i * 2] = (uint16_t)words[i] >> 8;
+    data[i * 2 + 1] = words[i] & 0xFF;
+  }
+}
+
+static boolean mpuFifoEnabled() {
+  return (hostMpu.registers[0x6A] & 0x40) && hostMpu.registers[0x23] && !(hostMpu.registers[0x6B] & 0x40);
+}
+
+static void mpuStep() {
+  uint32_t period = 125 * (1 + hostMpu.registers[0x19]); // 8kHz gyro output rate (no DLPF) / (1 + SMPLRT_DIV)
+  if (simTime - hostMpu.lastFifoTime < period) return;
+  hostMpu.lastFifoTime += period;
+  if (simTime - hostMpu.lastFifoTime >= period) hostMpu.lastFifoTime = simTime;
+  if (!mpuFifoEnabled()) return;
+
+  byte data[14];
+  mpuSampleBytes(data);
+  for (byte i = 0; i < 14; i++) hostMpu.fifo.push_back(data[i]);
+  while (hostMpu.fifo.size() > 1024) hostMpu.fifo.pop_front(); // Overflow: the oldest bytes are lost
+  hostMpu.fifoSamples++;
+}
+
+static void mpuWriteRegister(byte reg, byte value) {
+  reg &= 0x7F;
+  if (reg == 0x6A && (value & 0x04)) { // FIFO_RESET
+    hostMpu.fifo.clear();
+    value &= ~0x04;
+  }
+  if (reg == 0x6B && (value & 0x80)) { // DEVICE_RESET
+    memset(hostMpu.registers, 0, sizeof(hostMpu.registers));
+    hostMpu.fifo.clear();
+    value = 0x40;
+  }
+  hostMpu.registers[reg] = value;
+}
+
+// Snapshot of the registers, which are read next (the MPU-6050 updates them together)
+static void mpuLatchRegisters(byte reg) {
+  if (reg >= 0x3B && reg <= 0x48) mpuSampleBytes(&hostMpu.registers[0x3B]);
+  if (reg == 0x72 || reg == 0x73) {
+    hostMpu.registers[0x72] = hostMpu.fifo.size() >> 8;
+    hostMpu.registers[0x73] = hostMpu.fifo.size() & 0xFF;
+  }
+  hostMpu.registers[0x75] = mpuAddress;
+}
+
+static byte mpuReadRegister(byte &reg) {
+  if (reg == 0x74) { // FIFO_R_W: the register pointer stays
+    if (hostMpu.fifo.empty()) return 0xFF;
+    byte value = hostMpu.fifo.front();
+    hostMpu.fifo.pop_front();
+    return value;
+  }
+  byte value = hostMpu.registers[reg & 0x7F];
+  reg++;
+  return value;
+}
+
+//
+// =======================================================================================================
+// TWI MASTER
+// =======================================================================================================
+//
+
+enum twiActions {
+  TWI_NONE,
+  TWI_START,
+  TWI_STOP,
+  TWI_WRITE,
+  TWI_READ
+};
+
+static byte twiAction;
+static double twiDoneTime; // us
+static boolean twiSlaveSelected, twiReceiving, twiFirstByte, twiStarted;
+static byte twiRegister;
+
+static double twiBitTime() {
+  return (16.0 + 2.0 * TWBR.value) * 1000000.0 / F_CPU; // Prescaler 1
+}
+
+static void twiWrite(byte oldValue) {
+  byte value = TWCR.value;
+  if (!(value & _BV(TWEN))) {
+    twiAction = TWI_NONE;
+    twiStarted = false;
+    return;
+  }
+  if (!(value & _BV(TWINT))) { // Interrupt enable change only, the TWINT flag stays as it was
+    TWCR.value = (value & ~_BV(TWINT)) | (oldValue & _BV(TWINT));
+    return;
+  }
+  TWCR.value &= ~_BV(TWINT); // Writing a one clears the flag and starts the next action
+
+  if (value & _BV(TWSTA)) {
+    twiAction = TWI_START;
+    twiDoneTime = simTime + twiBitTime();
+  }
+  else if (value & _BV(TWSTO)) {
+    twiAction = TWI_STOP;
+    twiDoneTime = simTime + twiBitTime();
+  }
+  else if (!twiStarted) {
+    twiAction = TWI_NONE;
+  }
+  else {
+    twiAction = twiReceiving && twiSlaveSelected ? TWI_READ : TWI_WRITE;
+    twiDoneTime = simTime + 9 * twiBitTime();
+  }
+}
+
+static void twiStep() {
+  if (twiAction == TWI_NONE || simTime < twiDoneTime) return;
+  byte action = twiAction;
+  twiAction = TWI_NONE;
+
+  switch (action) {
+    case TWI_START:
+      TWSR.value = twiStarted ? TW_REP_START : TW_START;
+      twiStarted = true;
+      twiSlaveSelected = false;
+      twiReceiving = false;
+      break;
+
+    case TWI_STOP:
+      TWCR.value &= ~_BV(TWSTO);
+      twiStarted = false;
+      twiSlaveSelected = false;
+      TWSR.value = 0xF8;
+      return; // No interrupt after a stop condition
+
+    case TWI_WRITE:
+      hostTwiBytes++;
+      if (!twiSlaveSelected) { // Address byte
+        byte address = TWDR.value >> 1;
+        boolean read = TWDR.value & 1;
+        twiSlaveSelected = address == mpuAddress && hostMpu.present;
+        twiReceiving = read;
+        if (read) {
+          TWSR.value = twiSlaveSelected ? TW_MR_SLA_ACK : TW_MR_SLA_NACK;
+          if (twiSlaveSelected) mpuLatchRegisters(twiRegister);
+        }
+        else {
+          TWSR.value = twiSlaveSelected ? TW_MT_SLA_ACK : TW_MT_SLA_NACK;
+          twiFirstByte = true;
+        }
+      }
+      else { // Register address or data
+        if (twiFirstByte) twiRegister = TWDR.value;
+        else mpuWriteRegister(twiRegister++, TWDR.value);
+        twiFirstByte = false;
+        TWSR.value = TW_MT_DATA_ACK;
+      }
+      break;
+
+    case TWI_READ:
+      hostTwiBytes++;
+      TWDR.value = mpuReadRegister(twiRegister);
+      TWSR.value = (TWCR.value & _BV(TWEA)) ? TW_MR_DATA_ACK : TW_MR_DATA_NACK;
+      break;
+  }
+  TWCR.value |= _BV(TWINT);
+}
+
+//
+// =======================================================================================================
+// UART TRANSMITTER
+// =======================================================================================================
+//
+
+static boolean uartDataFull; // A byte waits in UDR0 for the shift register
+static double uartShiftDone; // us
+
+static boolean uartDataEmpty() {
+  return !uartDataFull;
+}
+
+static double uartByteTime() {
+  byte format = UCSR0C.value;
+  int bits = 1 + 5 + ((format >> UCSZ00) & 3) + ((format & _BV(UPM01)) ? 1 : 0) + ((format & _BV(USBS0)) ? 2 : 1);
+  double divider = (UCSR0A.value & _BV(U2X0)) ? 8.0 : 16.0;
+  return bits * divider * (UBRR0.value + 1) * 1000000.0 / F_CPU;
+}
+
+static void uartWrite() {
+  if (!(UCSR0B.value & _BV(TXEN0))) return;
+  hostUartOutput.push_back(UDR0.value);
+  if (simTime >= uartShiftDone) uartShiftDone = simTime + uartByteTime(); // Directly into the shift register
+  else uartDataFull = true;
+}
+
+static void uartStep() {
+  if (uartDataFull && simTime >= uartShiftDone) {
+    uartDataFull = false;
+    uartShiftDone += uartByteTime();
+  }
+}
+
+//
+// =======================================================================================================
+// TIMER 1 (CTC MODE 12, TOP = ICR1)
+// =======================================================================================================
+//
+
+static void timer1Step() {
+  byte clock = TCCR1B.value & 7;
+  if (clock == 0) return;
+  byte ticks = clock == 1 ? F_CPU / 1000000UL : F_CPU / 8000000UL; // Prescaler 1 or 8 (no others used)
+  for (byte i = 0; i < ticks; i++) {
+    uint16_t top = (TCCR1B.value & _BV(WGM13)) ? ICR1.value : 0xFFFF;
+    TCNT1.value = TCNT1.value == top ? 0 : TCNT1.value + 1;
+    if (TCNT1.value == top) TIFR1.value |= _BV(ICF1);
+    if (TCNT1.value == OCR1A.value) TIFR1.value |= _BV(OCF1A);
+    if (TCNT1.value == OCR1B.value) TIFR1.value |= _BV(OCF1B);
+  }
+}
+
+//
+// =======================================================================================================
+// NRF24L01
+// =======================================================================================================
+//
+
+static void radioIrqLine() {
+  boolean level = hostRadio.rxReady && !hostRadio.rxMasked ? LOW : HIGH;
+  if (irqLevel == HIGH && level == LOW && hostRadio.irqPin) {
+    int number = digitalPinToInterrupt(hostRadio.irqPin);
+    if (number >= 0) extPending[number] = true;
+  }
+  irqLevel = level;
+}
+
+boolean hostRadioDeliver(byte channel, const void *packet, byte size) {
+  if (!hostRadio.listening || channel != hostRadio.channel) return false;
+  if (hostRadio.rxFifo.size() >= 3) {
+    hostRadio.lost++;
+    return false;
+  }
+  const byte *bytes = (const byte *)packet;
+  hostRadio.rxFifo.push_back(std::vector<byte>(bytes, bytes + size));
+  hostRadio.rxReady = true;
+  radioIrqLine();
+  dispatchInterrupts();
+  return true;
+}
+
+// Called by the RF24 stub for each SPI transaction
+void hostRadioSpi(byte bytes) {
+  hostRadio.spiTransactions++;
+  if (hostInIsr) hostRadio.spiInIsr++;
+  hostAdvance(4 + bytes * 2); // 4MHz SPI clock, plus the library overhead
+}
+
+void hostRadioClearIrq() {
+  hostRadio.rxReady = false;
+  radioIrqLine();
+}
+
+std::vector<byte> hostStickPacket(uint32_t time) {
+  uint32_t ms = time / 1000;
+  std::vector<byte> packet(9);
+  for (byte i = 0; i < 4; i++) packet[i] = 50 + 50 * sin(ms / (700.0 + 300 * i)); // axis1 - 4
+  packet[4] = 1; // mode1
+  packet[5] = 0; // mode2
+  packet[6] = (ms / 2000) & 1; // momentary1
+  packet[7] = 50; // pot1
+  packet[8] = ms / 10; // sequence
+  return packet;
+}
+
+static void transmitterStep() {
+  if (!hostTransmitter.enabled || (int32_t)(simTime - hostTransmitter.nextTime) < 0) return;
+  hostTransmitter.nextTime += hostTransmitter.interval;
+  std::vector<byte> packet = hostTransmitter.packet ? hostTransmitter.packet(simTime) : hostStickPacket(simTime);
+  byte channel = hostTransmitter.channel ? hostTransmitter.channel : hostRadio.channel;
+  hostTransmitter.sent++;
+  if (hostTransmitter.interference && hostTransmitter.interference(channel, simTime)) return;
+  hostRadioDeliver(channel, packet.data(), packet.size());
+}
+
+//
+// =======================================================================================================
+// REGISTER HOOKS & PERIPHERAL STEP
+// =======================================================================================================
+//
+
+unsigned int hostRegisterRead(byte id, unsigned int value) {
+  if (id == REG_SREG) return hostInterruptsEnabled ? _BV(SREG_I) : 0; // Only the I flag
+  return value;
+}
+
+void hostRegisterWrite(byte id, unsigned int oldValue) {
+  switch (id) {
+    case REG_PORTB:
+    case REG_PORTC:
+    case REG_PORTD: {
+        hostRegister8 &port = id == REG_PORTB ? PORTB : (id == REG_PORTC ? PORTC : PORTD);
+        if (port.value != oldValue && hostPortChanged) hostPortChanged("BCD"[id - REG_PORTB], oldValue, port.value);
+        break;
+      }
+
+    case REG_TIFR1: // Writing a one clears the flag
+      TIFR1.value = oldValue & ~TIFR1.value;
+      break;
+
+    case REG_TWCR:
+      twiWrite(oldValue);
+      break;
+
+    case REG_UDR0:
+      uartWrite();
+      break;
+
+    case REG_SREG: // Restores the I flag (byte sreg = SREG; cli(); ... SREG = sreg;)
+      if (SREG.value & _BV(SREG_I)) sei();
+      else cli();
+      break;
+
+    case REG_ADCSRA: // The conversion is done immediately
+      if (ADCSRA.value & _BV(ADSC)) {
+        int result = adcValue(ADMUX.value & 0x0F);
+        ADCL.value = result & 0xFF;
+        ADCH.value = result >> 8;
+        ADCSRA.value &= ~_BV(ADSC);
+      }
+      break;
+  }
+}
+
+static void stepPeripherals() {
+  timer1Step();
+  twiStep();
+  uartStep();
+  mpuStep();
+  transmitterStep();
+  radioIrqLine();
+}
+
+//
+// =======================================================================================================
+// RESET
+// =======================================================================================================
+//
+
+void hostReset() {
+  hostMpu.present = true;
+  hostMpu.sample = nullptr;
+  memset(hostMpu.registers, 0, sizeof(hostMpu.registers));
+  hostMpu.registers[0x6B] = 0x40; // Sleep mode after power up
+  hostMpu.fifo.clear();
+  hostMpu.fifoSamples = 0;
+
+  hostRadio.channel = 0;
+  hostRadio.listening = false;
+  hostRadio.rxFifo.clear();
+  hostRadio.ackPayload.clear();
+  hostRadio.rxReady = false;
+  hostRadio.rxMasked = false;
+  hostRadio.spiTransactions = 0;
+  hostRadio.spiInIsr = 0;
+  hostRadio.lost = 0;
+  radioIrqLine();
+
+  hostTransmitter.enabled = false;
+  hostTransmitter.interval = 10000;
+  hostTransmitter.packet = nullptr;
+  hostTransmitter.channel = 0;
+  hostTransmitter.interference = nullptr;
+  hostTransmitter.nextTime = simTime;
+  hostTransmitter.sent = 0;
+
+  memset(hostMotor, 0, sizeof(hostMotor));
+  hostUartOutput.clear();
+  Serial.output.clear();
+}
+
+static struct hostPowerUp {
+  hostPowerUp() {
+    memset(hostEeprom, 0xFF, sizeof(hostEeprom)); // Erased EEPROM
+    hostReset();
+  }
+} powerUp;
@@ -0,0 +1,112 @@
+#ifndef host_h
+#define host_h
+
+#include "Arduino.h"
+
+//
+// =======================================================================================================
+// HOST SIMULATION CONTROL (USED BY THE RUNNER, THE BENCHMARK AND THE TESTS)
+// =======================================================================================================
+//
+
+// Time
+uint32_t hostNow(); // us, without advancing
+void hostAdvance(uint32_t us); // Let the time pass, the peripherals run and the interrupts are called
+uint32_t hostCpuNanos(); // Host time in ns, without the time, which was spent in the simulation (benchmark clock)
+extern uint32_t hostMicrosCost; // us, which pass with each micros() call in simulated time (default 1)
+
+// Interrupts
+extern boolean hostInterruptsEnabled;
+extern boolean hostInIsr; // An interrupt vector is running
+extern uint32_t hostIsrCalls[4]; // Timer 1 capture, compare A, compare B, external interrupts
+
+// Ports: called after every change of PORTB, PORTC or PORTD (port 'B', 'C' or 'D')
+extern std::function<void(char port, byte oldValue, byte newValue)> hostPortChanged;
+extern int hostAnalogValue[8]; // A0 - A7, 0 - 1023
+extern uint32_t hostVccMillivolts; // Measured by readVcc() with the internal 1.1V reference
+
+// UART: the bytes, which were written to UDR0 (interrupt driven transmitter, not Serial)
+extern std::vector<byte> hostUartOutput;
+
+//
+// =======================================================================================================
+// MPU-6050 MODEL (I2C ADDRESS 0x68)
+// =======================================================================================================
+//
+
+struct hostMpuSample {
+  int16_t acc[3]; // +/-8g: 4096 = 1g
+  int16_t temperature; // raw / 340 + 36.53 = °C
+  int16_t gyro[3]; // +/-2000°/s: 16.4 = 1°/s
+};
+
+struct hostMpuModel {
+  boolean present;
+  std::function<hostMpuSample(uint32_t time)> sample; // Sensor data at "time" (us)
+  byte registers[128];
+  std::deque<byte> fifo; // Max. 1024 bytes, a sample, which doesn't fit, is cut (misaligned, like an overflow)
+  uint32_t fifoSamples; // Samples, which were written to the FIFO
+  uint32_t lastFifoTime;
+};
+
+extern hostMpuModel hostMpu;
+extern uint32_t hostTwiBytes; // Transferred bytes (address & data)
+
+//
+// =======================================================================================================
+// NRF24L01 MODEL
+// =======================================================================================================
+//
+
+struct hostRadioModel {
+  byte channel;
+  boolean listening;
+  std::deque<std::vector<byte> > rxFifo; // Max. 3 packets, like the NRF24L01
+  std::vector<byte> ackPayload;
+  boolean rxReady; // RX_DR flag, the IRQ pin is low while it is set (and not masked)
+  boolean rxMasked;
+  uint32_t spiTransactions;
+  uint32_t spiInIsr; // SPI transactions, which were done in an interrupt
+  uint32_t lost; // Packets, which did not fit into the RX FIFO
+  byte irqPin; // Arduino pin of the IRQ line (0 = not connected)
+};
+
+extern hostRadioModel hostRadio;
+
+// Deliver a packet, if the radio listens on "channel". Returns false, if it was not received
+boolean hostRadioDeliver(byte channel, const void *packet, byte size);
+
+// Built in transmitter: sends a packet every "interval" us
+struct hostTransmitterModel {
+  boolean enabled;
+  uint32_t interval;
+  byte channel; // 0 = the channel, which the receiver uses
+  std::function<boolean(byte channel, uint32_t time)> interference; // Returns true, if the packet is destroyed
+  std::function<std::vector<byte>(uint32_t time)> packet;
+  uint32_t nextTime;
+  uint32_t sent;
+};
+
+extern hostTransmitterModel hostTransmitter;
+std::vector<byte> hostStickPacket(uint32_t time); // Old 9 byte format, all axes sweep slowly
+
+//
+// =======================================================================================================
+// MOTOR DRIVERS & EEPROM
+// =======================================================================================================
+//
+
+struct hostMotorState {
+  int input; // Last drive() input value
+  int minPwm, maxPwm;
+  uint32_t calls;
+};
+
+extern hostMotorState hostMotor[2]; // In the order of the begin() calls
+
+extern byte hostEeprom[1024];
+
+// Reset all models to their power up state (time keeps running)
+void hostReset();
+
+#endif
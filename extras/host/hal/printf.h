@@ -0,0 +1,8 @@
+#ifndef printf_h
+#define printf_h
+
+#include "Arduino.h"
+
+inline void printf_begin() {}
+
+#endif
@@ -0,0 +1,80 @@
+//
+// =======================================================================================================
+// SKETCH RUNNER
+// =======================================================================================================
+//
+
+// Runs setup() and loop() of one sketch variant for a simulated time, with the built in transmitter (stick sweep,
+// 10ms packet interval). Fails, if the servo frames, the servo pulse widths or the received stick positions are wrong.
+// Usage: run_<variant> [seconds] [us per loop pass (computation time, which is not simulated)]
+
+#include "sketch.cpp"
+
+struct servoMonitor {
+  uint32_t frames; // Rising edges of servo 1 (A0)
+  uint32_t pulses[4];
+  uint32_t badPulses;
+  uint32_t start[4];
+};
+
+servoMonitor monitor;
+
+void monitorPort(char port, byte oldValue, byte newValue) {
+  if (port != 'C') return;
+  for (byte i = 0; i < 4; i++) {
+    if (!(servoAttached & _BV(i))) continue;
+    boolean was = oldValue & _BV(i), is = newValue & _BV(i);
+    if (!was && is) {
+      monitor.start[i] = hostNow();
+      if (i == 0) monitor.frames++;
+    }
+    if (was && !is) {
+      uint32_t width = hostNow() - monitor.start[i];
+      monitor.pulses[i]++;
+      if (width + 2 < servoMinUs || width > servoMaxUs + 2) monitor.badPulses++;
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  uint32_t seconds = argc > 1 ? atoi(argv[1]) : 10;
+  uint32_t loopCost = argc > 2 ? atoi(argv[2]) : 500;
+
+#ifdef RADIO_IRQ_PIN
+  hostRadio.irqPin = RADIO_IRQ_PIN;
+#endif
+  hostPortChanged = monitorPort;
+  hostTransmitter.enabled = true;
+
+  setup();
+  uint32_t setupTime = hostNow();
+  uint32_t loops = 0;
+  byte axisMin = 255, axisMax = 0;
+  uint32_t failsafeLoops = 0;
+  uint32_t firstLoopTime = 0;
+
+  while (hostNow() - setupTime < seconds * 1000000UL) {
+    loop();
+    hostAdvance(loopCost);
+    if (!loops++) firstLoopTime = hostNow(); // The first pass may re-initialize the radio (blocks in DEBUG mode)
+    if (hostNow() - firstLoopTime > 1000000UL) { // The first packets need some time (channel search)
+      axisMin = min(axisMin, data.axis1);
+      axisMax = max(axisMax, data.axis1);
+      if (hazard) failsafeLoops++;
+    }
+  }
+
+  uint32_t expectedFrames = (uint64_t)seconds * servoFrameRate;
+  printf("%u loops in %us (setup %ums), %u servo frames, pulses %u %u %u %u (%u bad), axis 1 %u - %u, "
+         "%u packets sent, %u lost, %u loops in failsafe, %u UART bytes\n",
+         loops, seconds, setupTime / 1000, monitor.frames, monitor.pulses[0], monitor.pulses[1], monitor.pulses[2],
+         monitor.pulses[3], monitor.badPulses, axisMin, axisMax, hostTransmitter.sent, hostRadio.lost, failsafeLoops,
+         (unsigned)hostUartOutput.size());
+
+  boolean ok = true;
+  if (monitor.frames + 2 < expectedFrames) { printf("FAIL: servo frames missing\n"); ok = false; }
+  if (monitor.badPulses) { printf("FAIL: servo pulse width out of range\n"); ok = false; }
+  if (axisMin > 10 || axisMax < 90) { printf("FAIL: the stick positions were not received\n"); ok = false; }
+  if (failsafeLoops) { printf("FAIL: failsafe during reception\n"); ok = false; }
+  return ok ? 0 : 1;
+}
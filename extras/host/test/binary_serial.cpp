@@ -0,0 +1,81 @@
+//
+// =======================================================================================================
+// BINARY SERIAL FRAME (BINARY_SERIAL)
+// =======================================================================================================
+//
+
+// The 9 byte frame of a known state must be: 0xA5, 6, axis1 - axis4, pot1, switches, CRC-8 (polynomial 0x07) of the
+// length and the payload. The CRC must detect every single corrupted byte (value, length and CRC byte itself).
+
+#include "sketch.cpp"
+#include "test.h"
+
+// Loop passes until a new frame is sent, returns it (empty, if none was sent within 100ms)
+std::vector<byte> nextFrame() {
+  while (uartBusy()) hostAdvance(100); // The end of the previous frame
+  hostUartOutput.clear();
+  for (uint32_t start = hostNow(); hostNow() - start < 100000UL;) {
+    loop();
+    hostAdvance(500);
+    if (hostUartOutput.size() >= serialFrameLength) {
+      return std::vector<byte>(hostUartOutput.begin(), hostUartOutput.begin() + serialFrameLength);
+    }
+  }
+  return std::vector<byte>();
+}
+
+// The sound controller's check
+boolean frameValid(const std::vector<byte> &frame) {
+  return frame.size() == serialFrameLength && frame[0] == serialFrameStart && frame[1] == serialPayloadLength
+         && crc8(&frame[1], serialPayloadLength + 1) == frame[serialFrameLength - 1];
+}
+
+int main() {
+  // CRC-8 check value of "123456789" (polynomial 0x07, initial value 0, no reflection)
+  CHECK(crc8((const byte *)"123456789", 9) == 0xF4);
+
+  setup();
+  CHECK(serialCommands);
+
+  // Known state (loop() is called for less than 1s without packets, so there is no failsafe yet)
+  data.axis1 = 0;
+  data.axis2 = 25;
+  data.axis3 = 100;
+  data.axis4 = 73;
+  data.pot1 = 50;
+  data.mode1 = true;
+  data.mode2 = false;
+  data.momentary1 = true;
+  std::vector<byte> frame = nextFrame();
+  const byte expected[] = {0xA5, 6, 0, 25, 100, 73, 50, 0x05};
+  CHECK(frame.size() == serialFrameLength);
+  if (frame.size() != serialFrameLength) return testResult();
+  CHECK(memcmp(frame.data(), expected, sizeof(expected)) == 0);
+  CHECK(frame[8] == crc8(expected + 1, 7));
+  CHECK(frameValid(frame));
+  printf("Frame:");
+  for (byte b : frame) printf(" %02X", b);
+  printf("\n");
+
+  // Every single corrupted byte after the start byte is detected
+  int undetected = 0;
+  for (byte i = 1; i < serialFrameLength; i++) {
+    for (int error = 1; error < 256; error++) {
+      std::vector<byte> corrupted = frame;
+      corrupted[i] ^= error;
+      if (frameValid(corrupted)) undetected++;
+    }
+  }
+  printf("%d undetected single byte errors\n", undetected);
+  CHECK(undetected == 0);
+
+  // Switch bits
+  data.mode1 = false;
+  data.mode2 = true;
+  data.momentary1 = false;
+  frame = nextFrame();
+  CHECK(frameValid(frame));
+  CHECK(frame.size() == serialFrameLength && frame[7] == 0x02);
+
+  return testResult();
+}
@@ -0,0 +1,46 @@
+//
+// =======================================================================================================
+// BRAKE LIGHTS (TB6612FNG DRIVING MOTOR)
+// =======================================================================================================
+//
+
+// The throttle is ramped by slewUpdate() and passed to the motor driver with 0ms ramp time, so the brake light is
+// derived from the throttle ramp: on while it decelerates towards neutral, off when accelerating or in neutral.
+
+#include "sketch.cpp"
+#include "test.h"
+
+// Drives the car for "us" with a constant throttle, returns true, if the brake light was on at the end
+boolean drive(byte throttle, uint32_t us) {
+  data.axis3 = throttle;
+  for (uint32_t start = hostNow(); hostNow() - start < us;) {
+    driveMotorsCar();
+    led();
+    hostAdvance(2000);
+  }
+  return lights[LIGHT_TAIL].next == lightOnPattern;
+}
+
+int main() {
+  setup();
+  data.axis1 = data.axis2 = data.axis4 = 50;
+  data.mode2 = false; // maxAccelerationFull
+
+  CHECK(!drive(50, 100000UL)); // Neutral
+  CHECK(!drive(100, 100000UL)); // Accelerating
+  drive(100, 1000000UL);
+  CHECK(motorRamp.position == 100L << 16);
+  CHECK(!drive(100, 100000UL)); // Constant speed
+  CHECK(drive(50, 100000UL)); // Decelerating
+  drive(50, 1000000UL);
+  CHECK(!motorRamp.braking); // Stopped
+  CHECK(lights[LIGHT_TAIL].next != lightOnPattern);
+
+  CHECK(!drive(0, 100000UL)); // Reverse
+  drive(0, 1000000UL);
+  CHECK(drive(80, 100000UL)); // Decelerating through neutral
+  drive(80, 1000000UL);
+  CHECK(!motorRamp.braking);
+
+  return testResult();
+}
@@ -0,0 +1,63 @@
+//
+// =======================================================================================================
+// STEERING CURVES: FIXED POINT TABLES VS. FORMER FLOAT reMap()
+// =======================================================================================================
+//
+
+// The curves in steeringCurves.h are evaluated during compilation (curveValue()) and stored in the lookup tables of
+// lookupTables.h. The outputs must be the same as the ones of the former float reMap(), for all inputs.
+
+#include "sketch.cpp"
+#include "test.h"
+
+// Former float reMap(), but only with the segments of the curve (the original always scanned 13 segments and read
+// beyond the end of the shorter arrays)
+template <byte N> int floatReMap(const int16_t (&points)[N][2], int input) {
+  float pts[N][2];
+  for (byte i = 0; i < N; i++) {
+    pts[i][0] = points[i][0];
+    pts[i][1] = points[i][1];
+  }
+
+  int rr = 0;
+  float mm;
+  for (int nn = 0; nn < N - 1; nn++) {
+    if (input >= pts[nn][0] && input <= pts[nn + 1][0]) {
+      mm = ( pts[nn][1] - pts[nn + 1][1] ) / ( pts[nn][0] - pts[nn + 1][0] );
+      mm = mm * (input - pts[nn][0]);
+      mm = mm +  pts[nn][1];
+      rr = mm;
+    }
+  }
+  return rr;
+}
+
+template <byte N> void checkCurve(const char *name, const int16_t (&points)[N][2], const int8_t *lut) {
+  int mismatches = 0;
+  for (int i = points[0][0]; i <= points[N - 1][0]; i++) {
+    int expected = floatReMap(points, i);
+    if (curveValue(points, i) != expected) mismatches++;
+    if (lut && i <= 100 && (int8_t)pgm_read_byte(&lut[i]) != expected) mismatches++;
+  }
+  printf("%s: %d mismatches\n", name, mismatches);
+  CHECK(mismatches == 0);
+}
+
+int main() {
+  checkCurve("curveSemi", curveSemiPoints, curveSemiLut);
+  checkCurve("curveFull", curveFullPoints, curveFullLut);
+  checkCurve("curveThrust", curveThrustPoints, curveThrustLut);
+  checkCurve("curveForklift2", curveForklift2Points, NULL);
+  checkCurve("curveExponentialThrottle", curveExponentialThrottlePoints, NULL);
+
+  // Limited to the first and last point
+  CHECK(curveValue(curveSemiPoints, -5) == 60);
+  CHECK(curveValue(curveSemiPoints, 150) == 100);
+
+  // ESC table: map() and the exponential throttle curve, like the former ESC_MICROSECONDS ramp
+  for (int i = 0; i <= 100; i++) {
+    CHECK(pgm_read_word(&escMicrosecondsLut[i]) == floatReMap(curveExponentialThrottlePoints, map(i, 100, 0, 2000, 1000)));
+  }
+
+  return testResult();
+}
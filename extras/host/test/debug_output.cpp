@@ -0,0 +1,42 @@
+//
+// =======================================================================================================
+// DEBUG REPORTS (DEBUG, STAGE_TIMING, PROFILER & LATENCY_TIMING)
+// =======================================================================================================
+//
+
+// All measurements are printed on the Serial monitor
+
+#include "sketch.cpp"
+#include "test.h"
+
+boolean printed(const char *text) {
+  boolean found = Serial.output.find(text) != std::string::npos;
+  if (!found) printf("Not printed: \"%s\"\n", text);
+  return found;
+}
+
+int main() {
+  hostTransmitter.enabled = true;
+  setup();
+  for (uint32_t start = hostNow(); hostNow() - start < 5000000UL;) {
+    loop();
+    hostAdvance(500);
+  }
+
+  CHECK(printed("stage 6   avg us: ")); // helper.h
+  CHECK(printed("Link quality %: ")); // linkQuality.h
+  CHECK(printed("bad packets: 0"));
+  CHECK(printed("Task overruns:   IMU: ")); // scheduler.h
+  CHECK(printed("battery: "));
+
+  // The servo latency includes the wait for the next frame (20ms at 50Hz)
+  const latencyStats &servos = latency[LATENCY_SERVOS], &motors = latency[LATENCY_MOTORS];
+  CHECK(servos.count > 0 && motors.count > 0);
+  printf("latency servos: mean %uus, max %uus, motors: mean %uus\n", (unsigned)(servos.sum / servos.count), servos.max,
+         (unsigned)(motors.sum / motors.count));
+  CHECK(servos.sum / servos.count > motors.sum / motors.count + 1000000UL / servoFrameRate / 4);
+  CHECK(servos.max <= 1000000UL / servoFrameRate + 5000);
+
+  if (testFailures) printf("%s\n", Serial.output.substr(Serial.output.size() - 2000).c_str());
+  return testResult();
+}
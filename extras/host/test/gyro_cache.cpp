@@ -0,0 +1,110 @@
+//
+// =======================================================================================================
+// GYRO CALIBRATION EEPROM CACHE
+// =======================================================================================================
+//
+
+// readGyroCache() must reject an erased EEPROM, another version and every corrupted byte. saveGyroCache() writes one
+// byte per writeGyroCacheStep() and the block reads back unchanged. setupMpu6050() uses a valid cache, which was
+// written at about the same temperature, else the short check (the simulated vehicle does not move).
+
+#include "sketch.cpp"
+#include "test.h"
+
+const int mpuGyro[3] = {20, -15, 8}; // Offsets and temperature of the default MPU-6050 model
+const int mpuTemperature = -1360;
+
+gyroCalibration cacheBlock(byte version, int x, int y, int z, int temperature) {
+  gyroCalibration block;
+  memset(&block, 0, sizeof(block));
+  block.version = version;
+  block.x = x;
+  block.y = y;
+  block.z = z;
+  block.temperature = temperature;
+  block.crc = crc8((byte *)&block, offsetof(gyroCalibration, crc));
+  return block;
+}
+
+void storeCache(const gyroCalibration &block) {
+  memcpy(hostEeprom + gyroCacheAddress, &block, sizeof(block));
+}
+
+// Power up calibration, returns true, if gyro_x_cal ... gyro_z_cal are equal to "expected"
+boolean calibrate(const int *expected) {
+  for (byte axis = 0; axis < 3; axis++) gyroSlope[axis] = 0;
+  setupMpu6050();
+  return gyro_x_cal == expected[0] && gyro_y_cal == expected[1] && gyro_z_cal == expected[2];
+}
+
+int main() {
+  const int cached[3] = {22, -13, 6}; // Within cacheTolerance of the short check
+
+  // Erased EEPROM: short check
+  memset(hostEeprom, 0xFF, sizeof(hostEeprom));
+  CHECK(!readGyroCache());
+  CHECK(calibrate(mpuGyro));
+  CHECK(!gyroCacheUsable);
+
+  // Valid cache at the same temperature: cached offsets
+  storeCache(cacheBlock(gyroCacheVersion, cached[0], cached[1], cached[2], mpuTemperature));
+  CHECK(readGyroCache());
+  CHECK(calibrate(cached));
+  CHECK(gyroCacheUsable);
+
+  // Another version (with a correct CRC)
+  storeCache(cacheBlock(gyroCacheVersion + 1, cached[0], cached[1], cached[2], mpuTemperature));
+  CHECK(!readGyroCache());
+  CHECK(calibrate(mpuGyro));
+
+  // Every single bit error before the CRC and in the CRC itself
+  gyroCalibration valid = cacheBlock(gyroCacheVersion, cached[0], cached[1], cached[2], mpuTemperature);
+  int undetected = 0;
+  for (size_t i = 0; i <= offsetof(gyroCalibration, crc); i++) {
+    for (byte bit = 0; bit < 8; bit++) {
+      storeCache(valid);
+      hostEeprom[gyroCacheAddress + i] ^= _BV(bit);
+      if (readGyroCache()) undetected++;
+    }
+  }
+  CHECK(undetected == 0);
+  storeCache(valid);
+  hostEeprom[gyroCacheAddress + offsetof(gyroCalibration, x)] ^= 0x01;
+  CHECK(calibrate(mpuGyro));
+
+  // Valid, but written 3.2°C colder: the short check is used, the cache is not usable
+  storeCache(cacheBlock(gyroCacheVersion, cached[0], cached[1], cached[2], mpuTemperature - 1100));
+  CHECK(readGyroCache());
+  CHECK(calibrate(mpuGyro));
+  CHECK(!gyroCacheUsable);
+
+  // Save / load round trip, one byte per step
+  memset(hostEeprom, 0xFF, sizeof(hostEeprom));
+  gyro_x_cal = 31;
+  gyro_y_cal = -27;
+  gyro_z_cal = 4;
+  temperature = -900;
+  gyroSlope[0] = 120;
+  gyroSlope[1] = -75;
+  gyroSlope[2] = 3;
+  saveGyroCache();
+  int steps = 0;
+  while (gyroCacheWriteIndex < sizeof(gyroCalibration) && steps < 1000) {
+    writeGyroCacheStep();
+    steps++;
+  }
+  CHECK(steps == sizeof(gyroCalibration));
+  CHECK(memcmp(hostEeprom + gyroCacheAddress, &gyroCache, sizeof(gyroCache)) == 0);
+  writeGyroCacheStep(); // Nothing pending
+  CHECK(hostEeprom[gyroCacheAddress + sizeof(gyroCalibration)] == 0xFF);
+
+  memset(&gyroCache, 0, sizeof(gyroCache));
+  CHECK(readGyroCache());
+  CHECK(gyroCache.version == gyroCacheVersion);
+  CHECK(gyroCache.x == 31 && gyroCache.y == -27 && gyroCache.z == 4);
+  CHECK(gyroCache.temperature == -900);
+  CHECK(gyroCache.slopeX == 120 && gyroCache.slopeY == -75 && gyroCache.slopeZ == 3);
+
+  printf("%d undetected bit errors, cache written in %d steps\n", undetected, steps);
+  return testResult();
+}
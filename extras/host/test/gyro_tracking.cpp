@@ -0,0 +1,101 @@
+//
+// =======================================================================================================
+// ONLINE GYRO BIAS TRACKING & TEMPERATURE COMPENSATION
+// =======================================================================================================
+//
+
+// trackGyroBias() is fed with raw MPU-6050 samples at 125Hz (gyro noise, drifting offsets and temperature):
+// - stationary: the offsets converge to the drifted gyro offsets
+// - throttle not neutral, accelerometer change or rotation: the offsets are not tracked
+// - temperature drift: the slopes are estimated, and the offsets follow the temperature while the vehicle moves
+
+#include "sketch.cpp"
+#include "test.h"
+
+std::mt19937 rng(1);
+std::normal_distribution<double> noise(0, 2); // Gyro LSB
+
+const int startTemperature = -1360; // 32.5°C
+
+// One sample. "offset" is the true gyro offset, "rotation" is added to all axes
+void sample(const double *offset, double temperatureRaw, boolean neutral, int accZ = 4096, int rotation = 0) {
+  gyro_x = lround(offset[0] + noise(rng)) + rotation;
+  gyro_y = lround(offset[1] + noise(rng)) + rotation;
+  gyro_z = lround(offset[2] + noise(rng)) + rotation;
+  acc_x_raw = 0;
+  acc_y_raw = 0;
+  acc_z_raw = accZ;
+  temperature = lround(temperatureRaw);
+  throttleNeutral = neutral;
+  trackGyroBias();
+}
+
+boolean offsetsNear(double x, double y, double z) {
+  return abs(gyro_x_cal - x) <= 1 && abs(gyro_y_cal - y) <= 1 && abs(gyro_z_cal - z) <= 1;
+}
+
+// Gyro offsets at "temperatureRaw" with "slope" LSB per °C
+void driftedOffsets(const int *reference, const double *slope, double temperatureRaw, double *offset) {
+  double degrees = (temperatureRaw - startTemperature) / 340;
+  for (byte axis = 0; axis < 3; axis++) offset[axis] = reference[axis] + slope[axis] * degrees;
+}
+
+void start(const int *bias) {
+  gyro_x_cal = bias[0];
+  gyro_y_cal = bias[1];
+  gyro_z_cal = bias[2];
+  temperature = startTemperature;
+  for (byte axis = 0; axis < 3; axis++) gyroSlope[axis] = 0;
+  setupGyroTracking(startTemperature, bias);
+}
+
+int main() {
+  // Power up offsets, then the gyro drifts (warm up) at a constant temperature: 40s stationary
+  const int powerUp[3] = {20, -15, 8};
+  const double drifted[3] = {26, -10, 12};
+  start(powerUp);
+  for (int i = 0; i < 5000; i++) sample(drifted, startTemperature, true);
+  printf("Converged offsets %d %d %d\n", (int)gyro_x_cal, (int)gyro_y_cal, (int)gyro_z_cal);
+  CHECK(offsetsNear(26, -10, 12));
+  CHECK(gyroSlope[0] == 0 && gyroSlope[1] == 0 && gyroSlope[2] == 0); // Temperature did not change
+
+  // Motion gate: the offsets drift further, but must not be tracked (16s each)
+  const double moved[3] = {32, -4, 18};
+  for (int i = 0; i < 2000; i++) sample(moved, startTemperature, false); // Throttle
+  CHECK(offsetsNear(26, -10, 12));
+  for (int i = 0; i < 2000; i++) sample(moved, startTemperature, true, i & 1 ? 4096 : 4596); // Vibration
+  CHECK(offsetsNear(26, -10, 12));
+  for (int i = 0; i < 2000; i++) sample(moved, startTemperature, true, 4096, 200); // Rotation 12°/s
+  CHECK(offsetsNear(26, -10, 12));
+
+  // Temperature drift: +1, -0.5 and 0 LSB per °C, 10°C in 60s, then 40s at the new temperature
+  const int reference[3] = {26, -10, 12};
+  const double slope[3] = {1, -0.5, 0};
+  start(reference);
+  double temperatureRaw = startTemperature;
+  for (int i = 0; i < 12500; i++) {
+    if (i < 7500) temperatureRaw = startTemperature + 3400.0 * i / 7500;
+    double offset[3];
+    driftedOffsets(reference, slope, temperatureRaw, offset);
+    sample(offset, temperatureRaw, true);
+  }
+  printf("Slopes %d %d %d (Q8 LSB per °C), offsets %d %d %d\n", gyroSlope[0], gyroSlope[1], gyroSlope[2],
+         (int)gyro_x_cal, (int)gyro_y_cal, (int)gyro_z_cal);
+  CHECK(abs(gyroSlope[0] - 256) <= 32);
+  CHECK(abs(gyroSlope[1] + 128) <= 32);
+  CHECK(abs(gyroSlope[2]) <= 32);
+  CHECK(offsetsNear(36, -15, 12));
+
+  // Driving (not tracked), +6°C in 20s: the offsets follow the temperature with the estimated slopes
+  double base = temperatureRaw;
+  for (int i = 0; i < 2500; i++) {
+    temperatureRaw = base + 2040.0 * i / 2500;
+    double offset[3];
+    driftedOffsets(reference, slope, temperatureRaw, offset);
+    sample(offset, temperatureRaw, false);
+  }
+  printf("Compensated offsets %d %d %d at +16°C\n", (int)gyro_x_cal, (int)gyro_y_cal, (int)gyro_z_cal);
+  CHECK(offsetsNear(42, -18, 12));
+
+  return testResult();
+}
@@ -0,0 +1,99 @@
+//
+// =======================================================================================================
+// FREQUENCY HOPPING WITH SIMULATED INTERFERENCE
+// =======================================================================================================
+//
+
+// The simulated transmitter sends every 10ms on a fixed channel, packets can be destroyed by interference.
+// - Re-acquisition: the transmitter switches to the other channel at a random time. The receiver must decode a
+//   packet on the new channel within 50ms
+// - Interference: 60% of the packets on a channel are lost. The link quality window must show it and blacklist the
+//   channel, but the receiver must still find the transmitter on it
+
+#include "sketch.cpp"
+#include "test.h"
+
+std::mt19937 rng(42);
+float lossRate; // Channel 1
+byte sequence, lastSequence;
+
+std::vector<byte> sequencePacket(uint32_t time) {
+  std::vector<byte> packet = hostStickPacket(time);
+  packet[8] = ++sequence;
+  return packet;
+}
+
+boolean interference(byte channel, uint32_t time) {
+  return channel == NRFchannel[0] && std::uniform_real_distribution<float>(0, 1)(rng) < lossRate;
+}
+
+// Runs loop() until a packet, which was sent from now on, is decoded or "timeout" us passed. Returns the time in us
+uint32_t runUntilPacket(uint32_t timeout) {
+  uint32_t start = hostNow();
+  byte first = sequence + 1;
+  while (hostNow() - start < timeout) {
+    loop();
+    hostAdvance(700);
+    if (data.sequence != lastSequence && (byte)(data.sequence - first) < 128) {
+      lastSequence = data.sequence;
+      return hostNow() - start;
+    }
+  }
+  return timeout;
+}
+
+void run(uint32_t us) {
+  for (uint32_t start = hostNow(); hostNow() - start < us;) {
+    loop();
+    hostAdvance(700);
+  }
+  lastSequence = data.sequence;
+}
+
+int main() {
+  hostTransmitter.packet = sequencePacket;
+  hostTransmitter.interference = interference;
+  hostTransmitter.channel = NRFchannel[0];
+  hostTransmitter.enabled = true;
+  setup();
+  run(2000000UL);
+  CHECK(chPointer == 0);
+
+  // Re-acquisition after a channel switch of the transmitter
+  uint32_t worst = 0;
+  for (byte i = 0; i < 40; i++) {
+    run(std::uniform_int_distribution<uint32_t>(200000UL, 1200000UL)(rng)); // random phase
+    hostTransmitter.channel = NRFchannel[(i + 1) % channelCount];
+    uint32_t time = runUntilPacket(500000UL);
+    if (time > worst) worst = time;
+    CHECK(NRFchannel[chPointer] == hostTransmitter.channel);
+  }
+  printf("re-acquisition: max. %ums (%u channel switches)\n", worst / 1000, linkChannelSwitches);
+  CHECK(worst < 50000UL);
+
+  // Interference on channel 1: blacklisted by the link quality window
+  hostTransmitter.channel = NRFchannel[0];
+  runUntilPacket(500000UL);
+  lossRate = 0.6;
+  byte minQuality = 100;
+  for (byte i = 0; i < 5; i++) {
+    run(1000000UL);
+    if (linkQualityPercent < minQuality) minQuality = linkQualityPercent;
+  }
+  printf("60%% loss on channel %u: link quality min. %u%%, channel quality %u%%, blacklisted %u\n", NRFchannel[0],
+         minQuality, channelQuality[0], hopBlacklisted(0));
+  CHECK(minQuality < 60);
+  CHECK(hopBlacklisted(0));
+
+  // The transmitter is still found on the blacklisted channel (second search cycle)
+  hostTransmitter.channel = NRFchannel[1];
+  runUntilPacket(500000UL);
+  lossRate = 0;
+  hostTransmitter.channel = NRFchannel[0];
+  uint32_t time = runUntilPacket(500000UL);
+  printf("re-acquisition on the blacklisted channel: %ums\n", time / 1000);
+  CHECK(time < 100000UL);
+  CHECK(chPointer == 0);
+
+  return testResult();
+}
@@ -0,0 +1,102 @@
+//
+// =======================================================================================================
+// IMU: FIXED POINT ANGLE CALCULATION VS. FORMER FLOAT VERSION
+// =======================================================================================================
+//
+
+// processMpu6050Data() is fed with synthetic MPU-6050 traces (pitch & roll motion, gyro & accelerometer noise) and
+// compared with the former float calculation (sqrt(), asin()) at 125Hz. The error bounds of balancing.h must hold:
+// < 0.01° up to +/-30°, < 0.1° up to +/-85°
+
+#include "sketch.cpp"
+#include "test.h"
+
+// Former float processMpu6050Data()
+namespace reference {
+float angle_pitch, angle_roll, yaw_rate;
+long acc_x, acc_y, acc_z;
+boolean set_gyro_angles;
+
+void process(int gyroX, int gyroY, int gyroZ, long accX, long accY, long accZ) {
+  angle_pitch += gyroX * 0.0004885;
+  angle_roll += gyroY * 0.0004885;
+  yaw_rate = gyroZ * 0.0004885;
+
+  acc_x = (acc_x * 9 + accX) / 10;
+  acc_y = (acc_y * 9 + accY) / 10;
+  acc_z = (acc_z * 9 + accZ) / 10;
+  float acc_total_vector = sqrt((acc_x * acc_x) + (acc_y * acc_y) + (acc_z * acc_z));
+  float angle_pitch_acc = asin((float)acc_y / acc_total_vector) * 57.296;
+  float angle_roll_acc = asin((float)acc_x / acc_total_vector) * -57.296;
+
+  if (set_gyro_angles) {
+    angle_pitch = angle_pitch * 0.99 + angle_pitch_acc * 0.01;
+    angle_roll = angle_roll * 0.99 + angle_roll_acc * 0.01;
+  }
+  else {
+    angle_pitch = angle_pitch_acc;
+    angle_roll = angle_roll_acc;
+    set_gyro_angles = true;
+  }
+}
+}
+
+// Runs one trace (60s at 125Hz), returns the max. pitch, roll and yaw rate difference in degrees
+void runTrace(int seed, double amplitude, double &maxPitch, double &maxRoll, double &maxYaw) {
+  std::mt19937 rng(seed);
+  std::normal_distribution<double> noise(0, 1);
+  double pitch = 0, roll = 0;
+
+  set_gyro_angles = false;
+  acc_x = acc_y = acc_z = 0;
+  angle_pitch_fx = angle_roll_fx = 0;
+  reference::set_gyro_angles = false;
+  reference::acc_x = reference::acc_y = reference::acc_z = 0;
+  reference::angle_pitch = reference::angle_roll = 0;
+  maxPitch = maxRoll = maxYaw = 0;
+
+  for (int step = 0; step < 7500; step++) {
+    double t = step * 0.008;
+    double newPitch = amplitude * sin(t * 0.7 + seed) * sin(t * 0.13);
+    double newRoll = amplitude * 0.5 * sin(t * 0.31 + seed * 2);
+    int gyroX = lround((newPitch - pitch) / 0.0004885 + noise(rng) * 20);
+    int gyroY = lround((newRoll - roll) / 0.0004885 + noise(rng) * 20);
+    int gyroZ = lround(noise(rng) * 300 + 2000 * sin(t));
+    pitch = newPitch;
+    roll = newRoll;
+    long accX = lround(-4096 * sin(roll * M_PI / 180) + noise(rng) * 150);
+    long accY = lround(4096 * sin(pitch * M_PI / 180) * cos(roll * M_PI / 180) + noise(rng) * 150);
+    long accZ = lround(4096 * cos(pitch * M_PI / 180) * cos(roll * M_PI / 180) + noise(rng) * 150);
+
+    reference::process(gyroX, gyroY, gyroZ, accX, accY, accZ);
+    gyro_x = gyroX;
+    gyro_y = gyroY;
+    gyro_z = gyroZ;
+    acc_x_raw = accX;
+    acc_y_raw = accY;
+    acc_z_raw = accZ;
+    processMpu6050Data(8000);
+
+    maxPitch = max(maxPitch, fabs(angle_pitch - reference::angle_pitch));
+    maxRoll = max(maxRoll, fabs(angle_roll - reference::angle_roll));
+    maxYaw = max(maxYaw, fabs(yaw_rate - reference::yaw_rate));
+  }
+}
+
+int main() {
+  vehicleType = 4; // Accelerometer angles are calculated for the balancing robot only
+  gyro_x_cal = gyro_y_cal = gyro_z_cal = 0;
+
+  for (int seed = 0; seed < 12; seed++) {
+    double amplitude = seed < 6 ? 30 : 85;
+    double maxPitch, maxRoll, maxYaw;
+    runTrace(seed, amplitude, maxPitch, maxRoll, maxYaw);
+    printf("trace %2d +/-%2.0f°: max. error pitch %.4f° roll %.4f° yaw rate %.5f°\n", seed, amplitude, maxPitch, maxRoll, maxYaw);
+    double bound = amplitude <= 30 ? 0.01 : 0.1;
+    CHECK(maxPitch < bound);
+    CHECK(maxRoll < bound);
+    CHECK(maxYaw < 0.001);
+  }
+
+  return testResult();
+}
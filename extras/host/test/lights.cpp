@@ -0,0 +1,70 @@
+//
+// =======================================================================================================
+// LIGHT ENGINE (BIT ANGLE MODULATION)
+// =======================================================================================================
+//
+
+// The on time of a light pin is measured in each 8128us cycle (127 * 64us):
+// - Constant brightness: the on time equals the level of the fade curve
+// - Fade in: the on time never drops from one cycle to the next (all bits of a cycle belong to the same level)
+
+#include "sketch.cpp"
+#include "test.h"
+
+const uint32_t cycleUs = ((1 << lightBits) - 1) * 64;
+const byte tailMask = _BV(A1 - A0);
+
+uint32_t onSince, onTime; // Tail light pin A1
+
+void portChanged(char port, byte oldValue, byte newValue) {
+  if (port != 'C' || !((oldValue ^ newValue) & tailMask)) return;
+  if (newValue & tailMask) onSince = hostNow();
+  else onTime += hostNow() - onSince;
+}
+
+// On time of the tail light in the next cycles (starting with the next cycle, the buffers are swapped at its start)
+std::vector<uint32_t> measureCycles(uint32_t cycles) {
+  std::vector<uint32_t> result;
+  for (byte front = lightFront; lightFront == front;) hostAdvance(1);
+  for (uint32_t i = 0; i < cycles; i++) {
+    onTime = 0;
+    if (PORTC & tailMask) onSince = hostNow();
+    hostAdvance(cycleUs);
+    if (PORTC & tailMask) onTime += hostNow() - onSince;
+    result.push_back(onTime);
+  }
+  return result;
+}
+
+int main() {
+  hostPortChanged = portChanged;
+  setupServos();
+  setupLights();
+  lightAttach(LIGHT_TAIL);
+
+  // Constant brightness
+  const lightStep *patterns[] = {lightOffPattern, lightTailPattern, lightOnPattern};
+  const byte brightness[] = {0, 65, 100};
+  for (byte i = 0; i < 3; i++) {
+    lightPattern(LIGHT_TAIL, patterns[i]);
+    measureCycles(20);
+    std::vector<uint32_t> on = measureCycles(10);
+    uint32_t expected = lightLevel(brightness[i]) * 64UL;
+    printf("%3u%%: level %3u, on time %uus, expected %uus\n", brightness[i], lightLevel(brightness[i]), on[9], expected);
+    for (uint32_t time : on) CHECK(time + 20 >= expected && time <= expected + 20);
+  }
+
+  // Fade in (headlight pattern: 25 cycles)
+  lightPattern(LIGHT_TAIL, lightOffPattern);
+  measureCycles(20);
+  lightPattern(LIGHT_TAIL, lightHeadPattern);
+  std::vector<uint32_t> fade = measureCycles(40);
+  for (byte i = 1; i < fade.size(); i++) {
+    if (fade[i] + 20 < fade[i - 1]) printf("cycle %u: on time %uus after %uus\n", i, fade[i], fade[i - 1]);
+    CHECK(fade[i] + 20 >= fade[i - 1]);
+  }
+  CHECK(fade.back() + 20 >= cycleUs);
+
+  printf("servo frame %uus, light slot shift %u\n", servoFrameTicks / servoTicksPerUs, lightSlotShift);
+  return testResult();
+}
@@ -0,0 +1,92 @@
+//
+// =======================================================================================================
+// PACKET DECODING
+// =======================================================================================================
+//
+
+// Only the old format (8 bytes, or 9 bytes with sequence number) and the packed format (10 bytes) are decoded.
+// All other sizes and unknown packed format versions are counted as bad packets and don't change "data".
+// Packed format: 5 axes with 11 bits (bits 0 - 54, LSB first), mode1, mode2 and momentary1 (bits 55 - 57). Every
+// combination of the axis limits, the midpoints and the switches must be decoded, values above 2000 are limited.
+
+#include "sketch.cpp"
+#include "test.h"
+
+// Packs the packet bit by bit (transmitter side)
+void pack(byte *packet, byte sequence, const uint16_t *axes, boolean mode1, boolean mode2, boolean momentary1) {
+  memset(packet, 0, sizeof(struct RcDataPacked));
+  packet[0] = packedFormat;
+  packet[1] = sequence;
+  byte *bits = packet + 2;
+  for (byte bit = 0; bit < 55; bit++) {
+    if (axes[bit / 11] & (1 << (bit % 11))) bits[bit / 8] |= 1 << (bit % 8);
+  }
+  boolean switches[3] = {mode1, mode2, momentary1};
+  for (byte i = 0; i < 3; i++) {
+    if (switches[i]) bits[(55 + i) / 8] |= 1 << ((55 + i) % 8);
+  }
+}
+
+// Round trip of all combinations, returns the number of wrong decodes
+int packedRoundTrip() {
+  const uint16_t values[] = {0, 1000, 1023, 2000, 2047};
+  const byte count = sizeof(values) / sizeof(values[0]);
+  int errors = 0;
+  for (int combination = 0; combination < count * count * count * count * count * 8; combination++) {
+    uint16_t axes[5];
+    int index = combination;
+    for (byte axis = 0; axis < 5; axis++) {
+      axes[axis] = values[index % count];
+      index /= count;
+    }
+    boolean mode1 = index & 1, mode2 = index & 2, momentary1 = index & 4;
+    byte packet[sizeof(struct RcDataPacked)];
+    pack(packet, combination & 0xFF, axes, mode1, mode2, momentary1);
+    if (!decodePacket(packet, sizeof(packet))) {
+      errors++;
+      continue;
+    }
+    uint16_t hiRes[5] = {dataHiRes.axis1, dataHiRes.axis2, dataHiRes.axis3, dataHiRes.axis4, dataHiRes.pot1};
+    byte percent[5] = {data.axis1, data.axis2, data.axis3, data.axis4, data.pot1};
+    boolean ok = data.mode1 == mode1 && data.mode2 == mode2 && data.momentary1 == momentary1
+                 && data.sequence == (combination & 0xFF) && rcDataSequence;
+    for (byte axis = 0; axis < 5; axis++) {
+      uint16_t expected = min(axes[axis], 2000);
+      if (hiRes[axis] != expected || percent[axis] != (expected + 10) / 20) ok = false;
+    }
+    if (!ok) errors++;
+  }
+  return errors;
+}
+
+int main() {
+  byte packet[32];
+  for (byte i = 0; i < sizeof(packet); i++) packet[i] = 20 + i;
+
+  for (byte size = 1; size <= sizeof(packet); size++) {
+    data.axis1 = 50;
+    unsigned int bad = linkBadPackets;
+    boolean valid = size == 8 || size == 9;
+    CHECK(decodePacket(packet, size) == valid);
+    CHECK(linkBadPackets == bad + (valid ? 0 : 1));
+    CHECK(data.axis1 == (valid ? 20 : 50) || size == sizeof(struct RcDataPacked));
+    if (valid) CHECK(rcDataSequence == (size == 9));
+  }
+
+  // Packed format: 10 bytes with the format ID
+  byte packed[sizeof(struct RcDataPacked)] = {packedFormat, 7};
+  packed[2] = 1000 & 0xFF; // axis1 = 1000 (50%)
+  packed[3] = 1000 >> 8;
+  CHECK(decodePacket(packed, sizeof(packed)));
+  CHECK(dataHiRes.axis1 == 1000 && data.axis1 == 50 && data.sequence == 7);
+  packed[0] = 0xA2; // Unknown version
+  unsigned int bad = linkBadPackets;
+  CHECK(!decodePacket(packed, sizeof(packed)));
+  CHECK(linkBadPackets == bad + 1);
+
+  int errors = packedRoundTrip();
+  printf("%d wrong packed round trips\n", errors);
+  CHECK(errors == 0);
+
+  return testResult();
+}
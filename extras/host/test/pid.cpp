@@ -0,0 +1,70 @@
+//
+// =======================================================================================================
+// FIXED POINT PID CONTROLLER VS. PID_v1 (FLOAT)
+// =======================================================================================================
+//
+
+// pidCompute() and the former PID_v1 algorithm control the same first order plant with setpoint steps, with the
+// gains of the angle (all pot1 positions) and speed loops in balancing(). The plant starts away from zero, so the
+// first sample checks, that there is no derivative kick. The outputs must differ by less than 1% of the output range.
+
+#include "sketch.cpp"
+#include "test.h"
+
+// PID_v1 (double = float on AVR), mode AUTOMATIC: lastInput is initialized with the input
+struct floatPid {
+  float kp, ki, kd, outputSum, lastInput, outMin, outMax;
+
+  void compute(float setpoint, float input, float &output) {
+    float error = setpoint - input;
+    float dInput = input - lastInput;
+    outputSum = constrain(outputSum + ki * error, outMin, outMax);
+    output = constrain(kp * error + outputSum - kd * dInput, outMin, outMax);
+    lastInput = input;
+  }
+};
+
+// Runs 8s of setpoint steps, returns the max. output difference
+double stepResponse(float kp, float ki, float kd, unsigned int rate, int limit, double step) {
+  double start = 4 * step; // Plant value at the start
+  floatPid reference = {kp, ki / rate, kd * rate, 0, (float)start, (float)-limit, (float)limit};
+  pidController pid = {};
+  pidSetTunings(pid, kp, ki, kd, rate);
+  pidSetOutputLimits(pid, -limit, limit);
+
+  double plantFloat = start, plantFixed = start, maxDifference = 0;
+  for (int i = 0; i < 1000; i++) {
+    double setpoint = i < 500 ? step : -1.5 * step;
+    float output;
+    reference.compute(setpoint, plantFloat, output);
+    long fixedOutput = pidCompute(pid, lround(setpoint * 65536), lround(plantFixed * 65536));
+
+    double difference = fabs(output - fixedOutput / 65536.0);
+    if (i == 0 && difference > 0.01 * limit) printf("first sample: float %.3f, fixed point %.3f\n", output, fixedOutput / 65536.0);
+    maxDifference = max(maxDifference, difference);
+
+    plantFloat += output * 0.05 - plantFloat * 0.02;
+    plantFixed += fixedOutput / 65536.0 * 0.05 - plantFixed * 0.02;
+  }
+  return maxDifference;
+}
+
+// Gains of balancing()
+const float speedKp = 0.9, speedKi = 0.03, speedKd = 0.0;
+const float angleKi = 25.0, angleKd = 0.12;
+
+int main() {
+  // Angle loop (kp = pot1 / 8)
+  for (int pot = 0; pot <= 100; pot += 10) {
+    double difference = stepResponse(pot / 8.0, angleKi, angleKd, anglePidRate, 43, 2.0);
+    printf("angle kp %5.2f: max. output difference %.4f\n", pot / 8.0, difference);
+    CHECK(difference < 0.43);
+  }
+
+  // Speed loop
+  double difference = stepResponse(speedKp, speedKi, speedKd, speedPidRate, 33, 20.0);
+  printf("speed: max. output difference %.4f\n", difference);
+  CHECK(difference < 0.33);
+
+  return testResult();
+}
@@ -0,0 +1,25 @@
+//
+// =======================================================================================================
+// CODE REGION PROFILER (PROFILER & DEBUG, CATERPILLAR VEHICLE)
+// =======================================================================================================
+//
+
+// The steering overlay of driveMotorsSteering() is measured in every loop pass and printed every 2s
+
+#include "sketch.cpp"
+#include "test.h"
+
+int main() {
+  hostTransmitter.enabled = true;
+  setup();
+  CHECK(vehicleType == 2);
+  for (uint32_t start = hostNow(); hostNow() - start < 5000000UL;) {
+    loop();
+    hostAdvance(500);
+  }
+
+  CHECK(profile[PROFILE_STEERING].count > 0);
+  CHECK(Serial.output.find("steering overlay   n: ") != std::string::npos);
+
+  return testResult();
+}
@@ -0,0 +1,82 @@
+//
+// =======================================================================================================
+// INTERRUPT DRIVEN RECEPTION (RADIO_IRQ_PIN)
+// =======================================================================================================
+//
+
+// The simulated NRF24L01 pulls its IRQ line low, as soon as a packet is in the RX FIFO. The sketch must
+// - never use SPI in the interrupt
+// - not poll the radio over SPI, if there is no IRQ
+// - decode the newest packet, if several arrived during one loop pass
+// - take the timestamp for the latency measurement in the interrupt (at the packet arrival)
+
+#include "sketch.cpp"
+#include "test.h"
+
+std::vector<uint32_t> sendTime(256); // Per sequence number
+
+std::vector<byte> sequencePacket(uint32_t time) {
+  static byte sequence;
+  std::vector<byte> packet = hostStickPacket(time);
+  packet[8] = ++sequence;
+  sendTime[sequence] = time;
+  return packet;
+}
+
+int main() {
+  hostRadio.irqPin = RADIO_IRQ_PIN;
+  hostTransmitter.packet = sequencePacket;
+  hostTransmitter.enabled = true;
+  setup();
+  CHECK(!(DDRD & _BV(RADIO_IRQ_PIN))); // Input, motor 2 IN2 is on MOTOR2_IN2_PIN
+
+  // Reception during 10s
+  uint32_t received = 0, lateTimestamps = 0, spiStart = 0, sentStart = 0;
+  byte lastSequence = 0;
+  for (uint32_t start = hostNow(); hostNow() - start < 10000000UL;) {
+    if (hostNow() - start < 1000000UL) { // Channel search
+      spiStart = hostRadio.spiTransactions;
+      sentStart = hostTransmitter.sent;
+      received = 0;
+    }
+    loop();
+    hostAdvance(700);
+    if (data.sequence != lastSequence) {
+      lastSequence = data.sequence;
+      received++;
+      if (rxTime - sendTime[data.sequence] > 10) lateTimestamps++; // The IRQ is delayed by the running interrupts only
+    }
+  }
+  uint32_t sent = hostTransmitter.sent - sentStart;
+  uint32_t spi = hostRadio.spiTransactions - spiStart;
+  printf("%u packets sent, %u received, %u lost, %u SPI transactions (%u in interrupts), %u late timestamps\n",
+         sent, received, hostRadio.lost, spi, hostRadio.spiInIsr, lateTimestamps);
+  CHECK(hostRadio.spiInIsr == 0);
+  CHECK(received + 10 >= sent);
+  CHECK(spi <= 8 * sent); // No polling: about 6 transactions per packet
+  CHECK(lateTimestamps == 0);
+
+  // Two packets during one loop pass: the newest one is decoded
+  hostTransmitter.enabled = false;
+  std::vector<byte> first = sequencePacket(hostNow());
+  hostAdvance(100);
+  std::vector<byte> second = sequencePacket(hostNow());
+  uint32_t secondTime = hostNow();
+  CHECK(hostRadioDeliver(hostRadio.channel, first.data(), first.size()));
+  CHECK(hostRadioDeliver(hostRadio.channel, second.data(), second.size()));
+  loop();
+  CHECK(data.sequence == second[8]);
+  CHECK(hostRadio.rxFifo.empty());
+  CHECK(rxTime - secondTime < 10); // IRQ of the first packet
+  CHECK(digitalRead(RADIO_IRQ_PIN) == HIGH);
+
+  // No packets, no IRQ: no SPI transactions (the channel search starts after 50ms without packets)
+  uint32_t spiIdle = hostRadio.spiTransactions;
+  for (byte i = 0; i < 20; i++) {
+    loop();
+    hostAdvance(700);
+  }
+  CHECK(hostRadio.spiTransactions == spiIdle);
+
+  return testResult();
+}
@@ -0,0 +1,75 @@
+//
+// =======================================================================================================
+// SBUS FRAME ENCODER
+// =======================================================================================================
+//
+
+// sbusSetChannel() only re-packs the changed channel. After every change, the whole 25 byte frame must be equal to a
+// frame, which is packed bit by bit like the former SBUS library: header 0x0F, 16 channels x 11 bit (LSB first),
+// flags 0, end byte 0.
+
+#include "sketch.cpp"
+#include "test.h"
+
+uint16_t values[16];
+
+// Returns true, if sbusFrame is equal to the bit by bit packed reference frame of values[]
+boolean frameCorrect() {
+  byte reference[sbusFrameLength] = {0x0F};
+  for (unsigned int bit = 0; bit < 16 * 11; bit++) {
+    if (values[bit / 11] & (1 << (bit % 11))) reference[1 + bit / 8] |= 1 << (bit % 8);
+  }
+  return memcmp(sbusFrame, reference, sbusFrameLength) == 0;
+}
+
+void set(byte channel, uint16_t value) {
+  values[channel] = value;
+  sbusSetChannel(channel, value);
+}
+
+int main() {
+  int errors = 0;
+
+  // All channels at the limits (0 is the initial value)
+  CHECK(frameCorrect());
+  for (byte channel = 0; channel < 16; channel++) {
+    set(channel, 2047);
+    if (!frameCorrect()) errors++;
+  }
+  for (byte channel = 0; channel < 16; channel++) {
+    set(channel, 0);
+    if (!frameCorrect()) errors++;
+  }
+
+  // Alternating limits (neighbour bits in the same bytes), then every single bit of every channel
+  for (byte channel = 0; channel < 16; channel++) set(channel, channel & 1 ? 2047 : 0);
+  CHECK(frameCorrect());
+  for (byte channel = 0; channel < 16; channel++) {
+    for (byte bit = 0; bit < 11; bit++) {
+      set(channel, values[channel] ^ _BV(bit));
+      if (!frameCorrect()) errors++;
+    }
+  }
+
+  // Random changes, including the SBUS range and unchanged values
+  std::mt19937 rng(1);
+  for (int i = 0; i < 100000; i++) {
+    byte channel = rng() % 16;
+    uint16_t value = rng() % 4 == 0 ? values[channel] : rng() % 2048;
+    set(channel, value);
+    if (!frameCorrect()) errors++;
+  }
+  printf("%d wrong frames\n", errors);
+  CHECK(errors == 0);
+
+  // Header, flags and end byte are never touched
+  CHECK(sbusFrame[0] == 0x0F);
+  CHECK(sbusFrame[23] == 0x00);
+  CHECK(sbusFrame[24] == 0x00);
+  for (byte channel = 0; channel < 16; channel++) set(channel, 2047);
+  CHECK(frameCorrect());
+  CHECK(sbusFrame[0] == 0x0F && sbusFrame[23] == 0x00 && sbusFrame[24] == 0x00);
+  CHECK(sbusFrame[22] == 0xFF); // Last data byte: bits 168 - 175 (channel 16)
+
+  return testResult();
+}
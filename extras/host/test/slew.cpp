@@ -0,0 +1,91 @@
+//
+// =======================================================================================================
+// SLEW RATE GENERATOR
+// =======================================================================================================
+//
+
+// slewUpdate() with a linear and an S-curve profile, ESC range (1500 -> 2000 -> 1500us):
+// - the output is monotonic and never overshoots the target
+// - the target is reached within the profile time (distance / slew rate, plus curveTime for the S-curve)
+// - S-curve: the velocity changes by max. one step per ms (smooth start and stop)
+// - the result doesn't depend on the loop time (1ms and 20ms update intervals)
+// - "braking" is set while the ramp moves towards neutral
+
+#include "sketch.cpp"
+#include "test.h"
+
+const slewProfile linearProfile = {slewStep(1000), slewStep(1000), 0};
+const slewProfile curveProfile = {slewStep(1000), slewStep(2000), 150};
+
+struct rampResult {
+  uint32_t time; // ms until the target was reached (0 = not reached)
+  boolean monotonic;
+  boolean overshoot;
+  boolean smooth; // S-curve velocity limit
+  boolean braking; // "braking" was always equal to "towards neutral"
+};
+
+// Runs the ramp from its position to "target", called every "interval" ms, for max. 2s
+rampResult runRamp(slewRamp &ramp, int target, const slewProfile &profile, uint32_t interval) {
+  rampResult result = {0, true, false, true, true};
+  int start = (ramp.position + 32768) >> 16;
+  int direction = target > start ? 1 : -1;
+  boolean towardsNeutral = direction * (1500 - start) > 0;
+  long velocityStep = profile.curveTime ? max((towardsNeutral ? profile.brakeStep : profile.accelerationStep)
+                                              / profile.curveTime, 1L) : 0;
+  int last = start;
+  for (uint32_t time = interval; time <= 2000; time += interval) {
+    long lastVelocity = ramp.velocity;
+    hostAdvance(interval * 1000 - 1); // micros() costs 1us
+    int output = slewUpdate(ramp, target, 1500, profile);
+    if ((output - last) * direction < 0) result.monotonic = false;
+    if ((output - target) * direction > 0) result.overshoot = true;
+    if (interval == 1 && profile.curveTime && abs(ramp.velocity - lastVelocity) > velocityStep) result.smooth = false;
+    if (output != target && ramp.braking != towardsNeutral) result.braking = false;
+    last = output;
+    if (output == target) {
+      result.time = time;
+      break;
+    }
+  }
+  return result;
+}
+
+// Accelerates to 2000 and brakes back to 1500, checks both ramps
+void checkProfile(const slewProfile &profile, uint32_t interval) {
+  slewRamp ramp;
+  slewReset(ramp, 1500);
+  uint32_t accelerationTime = 500 * 65536L / profile.accelerationStep + profile.curveTime;
+  uint32_t brakeTime = 500 * 65536L / profile.brakeStep + profile.curveTime;
+
+  rampResult up = runRamp(ramp, 2000, profile, interval);
+  rampResult down = runRamp(ramp, 1500, profile, interval);
+  printf("curveTime %ums, update every %ums: 1500 -> 2000us in %ums (max. %ums), -> 1500us in %ums (max. %ums)\n",
+         profile.curveTime, interval, up.time, accelerationTime, down.time, brakeTime);
+
+  rampResult results[2] = {up, down};
+  uint32_t maxTime[2] = {accelerationTime, brakeTime};
+  for (byte i = 0; i < 2; i++) {
+    CHECK(results[i].time > 0 && results[i].time <= maxTime[i] + interval);
+    CHECK(results[i].time + profile.curveTime / 2 + interval >= maxTime[i]); // Not faster than the slew rate
+    CHECK(results[i].monotonic);
+    CHECK(!results[i].overshoot);
+    CHECK(results[i].smooth);
+    CHECK(results[i].braking);
+  }
+}
+
+int main() {
+  checkProfile(linearProfile, 1);
+  checkProfile(linearProfile, 20);
+  checkProfile(curveProfile, 1);
+  checkProfile(curveProfile, 20);
+
+  // S-curve start: the first 10ms move less than a linear ramp would move in 3ms
+  slewRamp ramp;
+  slewReset(ramp, 1500);
+  hostAdvance(10000);
+  CHECK(slewUpdate(ramp, 2000, 1500, curveProfile) - 1500 < 3);
+
+  return testResult();
+}
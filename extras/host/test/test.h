@@ -0,0 +1,27 @@
+#ifndef test_h
+#define test_h
+
+//
+// =======================================================================================================
+// MINIMAL TEST HELPERS (include after "sketch.cpp")
+// =======================================================================================================
+//
+
+// CHECK() prints the failed condition and continues, testResult() is the exit code of main()
+
+int testFailures;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      testFailures++; \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+    } \
+  } while (0)
+
+int testResult() {
+  printf(testFailures ? "%d checks failed\n" : "OK\n", testFailures);
+  return testFailures ? 1 : 0;
+}
+
+#endif
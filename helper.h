@@ -18,4 +18,112 @@ void loopDuration() {
   timerOld = timer;
 }
 
+//
+// =======================================================================================================
+// CRC-8 (POLYNOMIAL 0x07)
+// =======================================================================================================
+//
+
+byte crc8(const byte *data, byte length) {
+  byte crc = 0;
+  while (length--) {
+    crc ^= *data++;
+    for (byte i = 0; i < 8; i++) crc = crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1;
+  }
+  return crc;
+}
+
+//
+// =======================================================================================================
+// LOOP STAGE TIME MEASUREMENT (if "#define STAGE_TIMING" is active in the main sketch)
+// =======================================================================================================
+//
+
+// The stages are measured back to back: each stageEnd() closes the current stage and opens the next one.
+// Results are printed every second in DEBUG mode, in us.
+// Note: micros() has a resolution of 8us @ 8MHz, so short stages are only visible in the average!
+// The host benchmark (extras/host) replaces the clock with the host CPU time in ns.
+
+enum loopStage {
+  STAGE_RADIO, // readRadio()
+  STAGE_SERVOS, // writeServos()
+  STAGE_DRIVE, // driveMotors...(), mrsc() or balancing()
+  STAGE_BATTERY, // checkBattery()
+  STAGE_OUTPUTS, // digitalOutputs()
+  STAGE_LED, // led()
+  STAGE_SERIAL, // sendSbusCommands() or sendSerialCommands()
+  STAGE_COUNT
+};
+
+#ifdef STAGE_TIMING
+
+#ifndef STAGE_CLOCK
+#define STAGE_CLOCK micros()
+#endif
+
+const unsigned int loopDeadline = 8000; // 8000us = 125Hz balancing / MRSC loop
+
+unsigned long stageStart;
+unsigned long loopStart;
+unsigned long stageSum[STAGE_COUNT];
+unsigned int stageMax[STAGE_COUNT];
+unsigned int loopMax;
+unsigned int loopCount;
+unsigned int deadlineMisses;
+
+void stageBegin() {
+  stageStart = STAGE_CLOCK;
+  loopStart = stageStart;
+}
+
+void stageEnd(byte stage) {
+  unsigned long now = STAGE_CLOCK;
+  unsigned int duration = now - stageStart;
+  stageSum[stage] += duration;
+  if (duration > stageMax[stage]) stageMax[stage] = duration;
+  stageStart = now;
+}
+
+void stageReport() {
+  unsigned int duration = stageStart - loopStart; // The last stageEnd() did set stageStart to the loop end
+  if (duration > loopMax) loopMax = duration;
+  if (duration > loopDeadline) deadlineMisses ++;
+  loopCount ++;
+
+  static unsigned long lastReport;
+  if (millis() - lastReport >= 1000) {
+    lastReport = millis();
+#ifdef DEBUG
+    Serial.print("vehicleType: ");
+    Serial.print(vehicleType);
+    Serial.print("   loops: ");
+    Serial.print(loopCount);
+    Serial.print("   max us: ");
+    Serial.print(loopMax);
+    Serial.print("   > deadline: ");
+    Serial.println(deadlineMisses);
+    for (byte i = 0; i < STAGE_COUNT; i++) {
+      Serial.print("stage ");
+      Serial.print(i);
+      Serial.print("   avg us: ");
+      Serial.print(stageSum[i] / loopCount);
+      Serial.print("   max us: ");
+      Serial.println(stageMax[i]);
+    }
+#endif
+    for (byte i = 0; i < STAGE_COUNT; i++) {
+      stageSum[i] = 0;
+      stageMax[i] = 0;
+    }
+    loopMax = 0;
+    loopCount = 0;
+    deadlineMisses = 0;
+  }
+}
+#else // Empty functions, if measurement is disabled
+void stageBegin() {}
+void stageEnd(byte) {}
+void stageReport() {}
+#endif
+
 #endif
@@ -0,0 +1,84 @@
+#ifndef hopping_h
+#define hopping_h
+
+#include "Arduino.h"
+
+//
+// =======================================================================================================
+// FREQUENCY HOPPING
+// =======================================================================================================
+//
+
+// Radio channels (up to 126 channels are supported). Must be the same as on the transmitter! The Micro RC
+// transmitter uses channel 1 and 2, so longer tables require a transmitter with the same table
+const byte NRFchannel[] {
+  1, 2
+};
+const byte channelCount = sizeof(NRFchannel) / sizeof(NRFchannel[0]);
+byte chPointer = 0; // Channel 1 (the first entry of the array) is active by default
+
+// If no packet is received during "hopTimeout", the next channel of the table is tried every "hopDwell".
+// Channels are skipped during the first search cycle, if they are blacklisted:
+// - "blacklistFailures" search hops without a packet on this channel (cleared by a packet on the channel) or
+// - a link quality below "blacklistQuality": received / (received + missed) packets on this channel during the last
+//   1s window of linkQuality.h, in which packets were received on it. The missed packets are counted with the sequence
+//   numbers, so this requires a transmitter, which sends them
+// If this cycle is not successful, all channels are tried in table order, so the transmitter is always found again.
+// The timing assumes the max. transmitter packet interval below (Micro RC transmitter: 10ms):
+// - hopTimeout: at least two missed packets, before the channel is changed
+// - hopDwell: each channel is monitored for more than one packet interval
+// Re-acquisition time with n usable channels: up to hopTimeout + n * hopDwell (24 + 2 * 12 = 48ms for 2 channels).
+// A blacklisted channel is found in the second search cycle, which takes up to n + 1 more dwell times.
+const byte txPacketInterval = 10; // ms
+const byte hopTimeout = 2 * txPacketInterval + 4; // ms
+const byte hopDwell = txPacketInterval + 2; // ms
+const byte blacklistFailures = 3;
+const byte blacklistQuality = 50; // %
+
+byte channelFailures[channelCount]; // 0 = good channel
+byte channelQuality[channelCount]; // %, 0 = not yet measured
+unsigned int channelPackets[channelCount]; // counters of the current window
+unsigned int channelMissed[channelCount];
+byte searchHops; // number of hops since the last packet
+
+// A packet was received on the current channel. "missed" = missed packets before it (see linkPacket())
+void hopPacketReceived(byte missed) {
+  channelFailures[chPointer] = 0;
+  channelPackets[chPointer] ++;
+  channelMissed[chPointer] += missed;
+  searchHops = 0;
+}
+
+// Evaluate the channel counters (call after each window of linkQuality.h)
+void hopQualityUpdate() {
+  for (byte i = 0; i < channelCount; i++) {
+    if (channelPackets[i]) channelQuality[i] = 100UL * channelPackets[i] / (channelPackets[i] + channelMissed[i]);
+    channelPackets[i] = 0;
+    channelMissed[i] = 0;
+  }
+}
+
+boolean hopBlacklisted(byte channel) {
+  return channelFailures[channel] >= blacklistFailures
+         || (channelQuality[channel] && channelQuality[channel] < blacklistQuality);
+}
+
+// Returns true, if chPointer was changed. "silence" = ms since the last packet
+boolean hopUpdate(unsigned long silence) {
+  static unsigned long lastHop;
+
+  if (silence < hopTimeout || millis() - lastHop < hopDwell) return false;
+  lastHop = millis();
+
+  if (channelFailures[chPointer] < 255) channelFailures[chPointer] ++;
+  if (searchHops < 255) searchHops ++;
+
+  for (byte i = 0; i < channelCount; i++) {
+    chPointer ++;
+    if (chPointer >= channelCount) chPointer = 0;
+    if (searchHops > channelCount || !hopBlacklisted(chPointer)) break; // usable channel found
+  }
+  return true;
+}
+
+#endif
@@ -0,0 +1,186 @@
+#ifndef i2c_h
+#define i2c_h
+
+#include "Arduino.h"
+#include <util/twi.h>
+
+//
+// =======================================================================================================
+// INTERRUPT DRIVEN I2C (TWI) MASTER
+// =======================================================================================================
+//
+
+// Replaces the Wire library for the MPU-6050. Wire waits in a busy loop until a transfer is done and hangs forever,
+// if the sensor drops out. Here, i2cStart() only starts the transfer. The TWI interrupt handles the rest of it.
+// Poll the result with i2cPoll(). A transfer, which is not done after "i2cTimeout", is aborted and the bus is recovered.
+// A transfer consists of up to 2 bytes, which are written (register address & value) and the bytes, which are read
+// afterwards (repeated start).
+
+const unsigned long i2cClock = 400000; // 400kHz (MPU-6050 fast mode)
+const unsigned int i2cTimeout = 3000; // us
+
+enum i2cStates {
+  I2C_IDLE,
+  I2C_BUSY,
+  I2C_DONE,
+  I2C_ERROR
+};
+
+volatile byte i2cState;
+byte i2cAddress;
+byte i2cTxBuffer[2];
+byte i2cTxLength;
+volatile byte i2cTxIndex;
+byte *i2cRxBuffer;
+byte i2cRxLength;
+volatile byte i2cRxIndex;
+unsigned long i2cStartTime;
+volatile unsigned int i2cErrors; // NACK, bus errors and timeouts
+
+//
+// =======================================================================================================
+// SETUP & BUS RECOVERY
+// =======================================================================================================
+//
+
+void setupI2c() {
+  pinMode(SDA, INPUT_PULLUP);                                          // Internal pullups (same as the Wire library)
+  pinMode(SCL, INPUT_PULLUP);
+  TWSR = 0;                                                            // Prescaler 1
+  TWBR = ((F_CPU / i2cClock) - 16) / 2;                                // Bit rate
+  TWCR = _BV(TWEN);                                                    // Enable TWI, interrupt is enabled with each transfer
+  i2cState = I2C_IDLE;
+}
+
+// A slave, which was interrupted in the middle of a byte may hold SDA low. Clock it out with up to 9 SCL pulses
+void i2cRecover() {
+  TWCR = 0;                                                            // Disable TWI, release the pins
+  for (byte i = 0; i < 9 && digitalRead(SDA) == LOW; i++) {
+    pinMode(SCL, OUTPUT);                                              // SCL low (open drain)
+    digitalWrite(SCL, LOW);
+    delayMicroseconds(5);
+    pinMode(SCL, INPUT_PULLUP);                                        // SCL high
+    delayMicroseconds(5);
+  }
+  setupI2c();
+}
+
+//
+// =======================================================================================================
+// TWI INTERRUPT
+// =======================================================================================================
+//
+
+void i2cStop(byte state) {
+  TWCR = _BV(TWINT) | _BV(TWEN) | _BV(TWSTO);                          // Send stop condition, interrupt off
+  if (state == I2C_ERROR) i2cErrors ++;
+  i2cState = state;
+}
+
+ISR(TWI_vect) {
+  switch (TW_STATUS) {
+    case TW_START:
+    case TW_REP_START:
+      if (i2cTxIndex < i2cTxLength || i2cRxLength == 0) TWDR = i2cAddress << 1 | TW_WRITE;
+      else TWDR = i2cAddress << 1 | TW_READ;
+      TWCR = _BV(TWINT) | _BV(TWEN) | _BV(TWIE);
+      break;
+
+    case TW_MT_SLA_ACK:
+    case TW_MT_DATA_ACK:
+      if (i2cTxIndex < i2cTxLength) {                                  // Write the next byte
+        TWDR = i2cTxBuffer[i2cTxIndex++];
+        TWCR = _BV(TWINT) | _BV(TWEN) | _BV(TWIE);
+      }
+      else if (i2cRxLength > 0) TWCR = _BV(TWINT) | _BV(TWEN) | _BV(TWIE) | _BV(TWSTA); // Repeated start for reading
+      else i2cStop(I2C_DONE);
+      break;
+
+    case TW_MR_DATA_ACK:
+      i2cRxBuffer[i2cRxIndex++] = TWDR;
+    // fall through - acknowledge the next byte
+    case TW_MR_SLA_ACK:
+      if (i2cRxIndex + 1 < i2cRxLength) TWCR = _BV(TWINT) | _BV(TWEN) | _BV(TWIE) | _BV(TWEA); // ACK: more bytes follow
+      else TWCR = _BV(TWINT) | _BV(TWEN) | _BV(TWIE);                  // NACK after the last byte
+      break;
+
+    case TW_MR_DATA_NACK:
+      i2cRxBuffer[i2cRxIndex++] = TWDR;
+      i2cStop(I2C_DONE);
+      break;
+
+    default:                                                           // Address or data NACK, bus error
+      i2cStop(I2C_ERROR);
+      break;
+  }
+}
+
+//
+// =======================================================================================================
+// NON BLOCKING TRANSFER
+// =======================================================================================================
+//
+
+// Start a transfer, returns false, if the bus is still busy
+boolean i2cStart(byte address, const byte *tx, byte txLength, byte *rx, byte rxLength) {
+  if (i2cState == I2C_BUSY) return false;
+
+  unsigned long stopTime = micros();
+  while (TWCR & _BV(TWSTO)) {                                          // The stop condition of the last transfer is still pending (a few us)
+    if (micros() - stopTime > i2cTimeout) {
+      i2cRecover();
+      break;
+    }
+  }
+
+  i2cAddress = address;
+  for (byte i = 0; i < txLength; i++) i2cTxBuffer[i] = tx[i];
+  i2cTxLength = txLength;
+  i2cTxIndex = 0;
+  i2cRxBuffer = rx;
+  i2cRxLength = rxLength;
+  i2cRxIndex = 0;
+  i2cStartTime = micros();
+  i2cState = I2C_BUSY;
+  TWCR = _BV(TWINT) | _BV(TWEN) | _BV(TWIE) | _BV(TWSTA);              // Send start condition
+  return true;
+}
+
+// Transfer state, aborts the transfer after a timeout
+byte i2cPoll() {
+  if (i2cState == I2C_BUSY && micros() - i2cStartTime > i2cTimeout) {
+    i2cRecover();
+    i2cErrors ++;
+    i2cState = I2C_ERROR;
+  }
+  return i2cState;
+}
+
+//
+// =======================================================================================================
+// BLOCKING TRANSFER (FOR SETUP)
+// =======================================================================================================
+//
+
+boolean i2cTransfer(byte address, const byte *tx, byte txLength, byte *rx, byte rxLength) {
+  while (i2cPoll() == I2C_BUSY);
+  i2cStart(address, tx, txLength, rx, rxLength);
+  while (i2cPoll() == I2C_BUSY);
+  return i2cState == I2C_DONE;
+}
+
+// Is a device with this address on the bus?
+boolean i2cProbe(byte address) {
+  return i2cTransfer(address, NULL, 0, NULL, 0);
+}
+
+boolean i2cWriteRegister(byte address, byte reg, byte value) {
+  byte tx[2] = {reg, value};
+  return i2cTransfer(address, tx, 2, NULL, 0);
+}
+
+boolean i2cReadRegisters(byte address, byte reg, byte *rx, byte length) {
+  return i2cTransfer(address, &reg, 1, rx, length);
+}
+
+#endif
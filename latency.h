@@ -0,0 +1,112 @@
+#ifndef latency_h
+#define latency_h
+
+#include "Arduino.h"
+
+//
+// =======================================================================================================
+// STICK TO OUTPUT LATENCY MEASUREMENT (if "#define LATENCY_TIMING" is active in the main sketch)
+// =======================================================================================================
+//
+
+// Every received packet is timestamped with micros(). The first time an output stage uses the new data, the
+// delay since reception is added to a histogram of this output. Every 10s min, mean, max and 99th percentile
+// are printed in DEBUG mode. The histogram uses 512us buckets, so the 99th percentile is rounded up to 512us.
+// The servo pulses are output by the next frame interrupt, so the time until the next frame start is added for them.
+
+enum latencyOutput {
+  LATENCY_SERVOS, // writeServos() and the next servo frame start (see servoFrameDelay() )
+  LATENCY_MOTORS, // driveMotors...(), mrsc() or balancing()
+  LATENCY_SERIAL, // SBUS or serial frame sent
+  LATENCY_OUTPUTS
+};
+
+#ifdef LATENCY_TIMING
+const byte latencyBuckets = 32; // 32 * 512us = 16.4ms, longer delays are counted in the last bucket
+const byte latencyBucketShift = 9; // 2^9 = 512us
+
+struct latencyStats {
+  unsigned int histogram[latencyBuckets];
+  unsigned int count;
+  unsigned long sum;
+  unsigned int min;
+  unsigned int max;
+  boolean pending; // the current packet was not yet used by this output
+};
+
+latencyStats latency[LATENCY_OUTPUTS];
+unsigned long latencyPacketTime;
+
+// A new packet was received at "timestamp" (micros())
+void latencyPacket(unsigned long timestamp) {
+  latencyPacketTime = timestamp;
+  for (byte i = 0; i < LATENCY_OUTPUTS; i++) latency[i].pending = true;
+}
+
+// The output stage did use the newest packet
+void latencyConsumed(byte output) {
+  latencyStats &stats = latency[output];
+  if (!stats.pending || stats.count == 0xFFFF) return;
+  stats.pending = false;
+
+  unsigned long duration = micros() - latencyPacketTime;
+  if (output == LATENCY_SERVOS) duration += servoFrameDelay(); // The new pulses are output with the next frame
+  if (duration > 0xFFFF) duration = 0xFFFF;
+
+  byte bucket = duration >> latencyBucketShift;
+  if (bucket >= latencyBuckets) bucket = latencyBuckets - 1;
+  stats.histogram[bucket] ++;
+  if (stats.count == 0 || duration < stats.min) stats.min = duration;
+  if (duration > stats.max) stats.max = duration;
+  stats.sum += duration;
+  stats.count ++;
+}
+
+// Upper limit of the bucket, which contains the 99th percentile
+unsigned int latencyP99(const latencyStats &stats) {
+  unsigned long limit = stats.count - stats.count / 100;
+  unsigned long total = 0;
+  for (byte i = 0; i < latencyBuckets; i++) {
+    total += stats.histogram[i];
+    if (total >= limit) return (unsigned int)(i + 1) << latencyBucketShift;
+  }
+  return stats.max;
+}
+
+void latencyReport() {
+  static unsigned long lastReport;
+  if (millis() - lastReport >= 10000) {
+    lastReport = millis();
+#ifdef DEBUG
+    for (byte i = 0; i < LATENCY_OUTPUTS; i++) {
+      Serial.print("latency ");
+      Serial.print(i);
+      Serial.print("   n: ");
+      Serial.print(latency[i].count);
+      if (latency[i].count > 0) {
+        Serial.print("   min us: ");
+        Serial.print(latency[i].min);
+        Serial.print("   mean us: ");
+        Serial.print(latency[i].sum / latency[i].count);
+        Serial.print("   max us: ");
+        Serial.print(latency[i].max);
+        Serial.print("   p99 us: ");
+        Serial.print(latencyP99(latency[i]));
+      }
+      Serial.println();
+    }
+#endif
+    for (byte i = 0; i < LATENCY_OUTPUTS; i++) {
+      boolean pending = latency[i].pending;
+      memset(&latency[i], 0, sizeof(latencyStats));
+      latency[i].pending = pending;
+    }
+  }
+}
+#else // Empty functions, if measurement is disabled
+void latencyPacket(unsigned long) {}
+void latencyConsumed(byte) {}
+void latencyReport() {}
+#endif
+
+#endif
@@ -0,0 +1,236 @@
+#ifndef lights_h
+#define lights_h
+
+#include "Arduino.h"
+
+//
+// =======================================================================================================
+// INTERRUPT DRIVEN LIGHT ENGINE
+// =======================================================================================================
+//
+
+// Replaces the statusLED library, which switches the lights in led() with millis() (soft PWM for the taillight).
+// That flickers, as soon as a loop pass takes longer, for example during setupRadio() or the MPU-6050 calibration.
+// Here, the brightness of each light is generated by the Timer 1 compare B interrupt, independent of the loop:
+// - The light pins are no PWM pins, so 7 bit "bit angle modulation" is used: bit n of the level is output for
+//   64us * 2^n. This needs only 7 short interrupts per 8.1ms cycle (123Hz refresh rate). The patterns are updated
+//   once per cycle, in the slot of the highest bit. The new levels are written to a back buffer, which is output
+//   from the next cycle on, so all bits of a cycle belong to the same level
+// - Timer 1 runs for the servo engine (see servos.h). Compare B is scheduled relative to it and wraps at its TOP.
+//   Bits, which are longer than the servo frame (4ms bit 6 at servoFrameRate 333), are split into several slots
+// - The interrupt doesn't block other interrupts, so the servo pulses are not delayed
+// - Each light runs a pattern from PROGMEM: a sequence of steps, which fade to a brightness and hold it. The brightness
+//   in % is converted by a PROGMEM fade curve (gamma 2), so fades look linear to the eye
+// The light pins must be on PORTC (A0 - A5) or PORTD (D0 - D7). Patterns are switched with lightPattern() in led().
+
+enum lightOutputs {
+  LIGHT_TAIL, // A1 = Servo 2 pin
+  LIGHT_HEAD, // 0 = RXI pin
+  LIGHT_INDICATOR_L, // A4 = SDA pin
+  LIGHT_INDICATOR_R, // A5 = SCL pin
+  LIGHT_BEACON, // A3 = Servo 4 pin
+  LIGHT_COUNT
+};
+
+const byte lightPins[LIGHT_COUNT] PROGMEM = {A1, 0, A4, A5, A3};
+
+const byte lightBits = 7; // Levels 0 - 127
+const uint16_t lightBitTicks = 64 * servoTicksPerUs; // Duration of the lowest bit
+
+// Longest slot (lightBitTicks << lightSlotShift), which is shorter than the servo frame, so OCR1B wraps at most once
+constexpr byte lightMaxShift(byte shift) {
+  return shift < lightBits - 1 && (lightBitTicks << (shift + 1)) < servoFrameTicks ? lightMaxShift(shift + 1) : shift;
+}
+const byte lightSlotShift = lightMaxShift(0);
+
+static_assert(lightBitTicks < servoFrameTicks, "servoFrameRate too high for the light engine");
+
+//
+// =======================================================================================================
+// FADE CURVE & PATTERNS
+// =======================================================================================================
+//
+
+// Brightness in % to level (gamma 2)
+constexpr byte lightLevel(long i) {
+  return (i * i * 127 + 5000) / 10000;
+}
+const byte lightCurveLut[] PROGMEM = { LUT_101(lightLevel) };
+
+// Fade and hold times are in cycles of 8.1ms. A hold time of 0 keeps the step forever
+struct lightStep {
+  byte brightness; // %, LIGHT_LOOP = restart the pattern
+  byte fade;
+  byte hold;
+};
+
+const byte LIGHT_LOOP = 255;
+
+const lightStep lightOffPattern[] PROGMEM = {{0, 8, 0}}; // Short fade out (bulb afterglow)
+const lightStep lightOnPattern[] PROGMEM = {{100, 0, 0}}; // Brake light: full brightness, immediately
+const lightStep lightTailPattern[] PROGMEM = {{65, 0, 0}}; // Taillight: 42% duty cycle (same as the old 10 / 14ms soft PWM)
+const lightStep lightHeadPattern[] PROGMEM = {{100, 25, 0}}; // Headlight: soft start
+const lightStep lightBeaconPattern[] PROGMEM = {{100, 3, 3}, {0, 6, 74}, {LIGHT_LOOP, 0, 0}}; // Rotating beacon, 0.7s
+const lightStep lightIndicatorPattern[] PROGMEM = {{100, 2, 44}, {0, 4, 42}, {LIGHT_LOOP, 0, 0}}; // 375ms on / off
+
+//
+// =======================================================================================================
+// LIGHT STATE
+// =======================================================================================================
+//
+
+struct lightState {
+  const lightStep *next; // Requested by lightPattern()
+  const lightStep *pattern;
+  byte step;
+  byte ticks; // Remaining cycles of the fade or hold time, 0 = forever
+  boolean fading;
+  int level; // % * 256
+  int delta; // per cycle while fading
+};
+
+lightState lights[LIGHT_COUNT];
+byte lightAttached; // Output bit mask
+byte lightMaskC, lightMaskD; // Port pins of the attached lights
+byte lightOnC[2][lightBits], lightOnD[2][lightBits]; // Port pins, which are on during bit n (front & back buffer)
+byte lightFront; // Buffer, which is output in the current cycle
+byte lightBit;
+byte lightSlots; // Remaining slots of the current bit
+
+// Start the current step of a light
+void lightStartStep(lightState &light) {
+  lightStep step;
+  memcpy_P(&step, &light.pattern[light.step], sizeof(step));
+  if (step.brightness == LIGHT_LOOP) {
+    light.step = 0;
+    memcpy_P(&step, light.pattern, sizeof(step));
+  }
+  int target = step.brightness << 8;
+  if (step.fade) {
+    light.delta = (target - light.level) / step.fade;
+    light.ticks = step.fade;
+    light.fading = true;
+  }
+  else {
+    light.level = target;
+    light.ticks = step.hold;
+    light.fading = false;
+  }
+}
+
+// Once per cycle: next fade or pattern step
+void lightAnimate(lightState &light) {
+  if (light.next != light.pattern) { // Pattern change
+    light.pattern = light.next;
+    light.step = 0;
+    lightStartStep(light);
+    return;
+  }
+  if (light.ticks == 0) return; // Hold forever
+
+  if (light.fading) light.level += light.delta;
+  if (--light.ticks) return;
+
+  if (light.fading) { // Fade done, hold the brightness
+    lightStep step;
+    memcpy_P(&step, &light.pattern[light.step], sizeof(step));
+    light.level = step.brightness << 8;
+    light.ticks = step.hold;
+    light.fading = false;
+  }
+  else { // Hold done, next step
+    light.step++;
+    lightStartStep(light);
+  }
+}
+
+//
+// =======================================================================================================
+// TIMER 1 COMPARE B INTERRUPT
+// =======================================================================================================
+//
+
+// Port writes are read-modify-write, so they are protected from the servo interrupt, which also writes PORTC
+void lightWrite(byte bit) {
+  cli();
+  PORTC = (PORTC & ~lightMaskC) | lightOnC[lightFront][bit];
+  PORTD = (PORTD & ~lightMaskD) | lightOnD[lightFront][bit];
+  sei();
+}
+
+ISR(TIMER1_COMPB_vect, ISR_NOBLOCK) {
+  byte bit = lightBit;
+  byte shift = min(bit, lightSlotShift);
+  boolean newCycle = bit == lightBits - 1 && lightSlots == 0;
+
+  if (lightSlots == 0) { // First slot of this bit
+    if (newCycle) lightFront ^= 1;                                     // Output the levels of the previous calculation
+    lightWrite(bit);
+    lightSlots = 1 << (bit - shift);
+  }
+
+  // 16 bit registers share the TEMP byte, a servo interrupt between the two byte accesses would corrupt them
+  byte sreg = SREG;
+  cli();
+  uint16_t next = OCR1B + (lightBitTicks << shift);                   // End of this slot, wraps at the servo frame TOP
+  if (next > servoFrameTicks - 1) next -= servoFrameTicks;            // TOP = ICR1 = servoFrameTicks - 1
+  OCR1B = next;
+  SREG = sreg;
+  if (--lightSlots == 0) lightBit = bit ? bit - 1 : lightBits - 1;
+  if (!newCycle) return;
+
+  // New cycle: calculate the new levels in the long time slot of the highest bit (used from the next cycle on)
+  byte back = lightFront ^ 1;
+  for (bit = 0; bit < lightBits; bit++) lightOnC[back][bit] = lightOnD[back][bit] = 0;
+  for (byte i = 0; i < LIGHT_COUNT; i++) {
+    if (!(lightAttached & _BV(i))) continue;
+    lightAnimate(lights[i]);
+    byte level = pgm_read_byte(&lightCurveLut[constrain((lights[i].level + 128) >> 8, 0, 100)]);
+    byte pin = pgm_read_byte(&lightPins[i]);
+    for (bit = 0; bit < lightBits; bit++) {
+      if (!(level & _BV(bit))) continue;
+      if (pin >= A0) lightOnC[back][bit] |= _BV(pin - A0);
+      else lightOnD[back][bit] |= _BV(pin);
+    }
+  }
+}
+
+//
+// =======================================================================================================
+// SETUP & PATTERN SELECTION
+// =======================================================================================================
+//
+
+// Call after setupServos() (Timer 1 must be running)
+void setupLights() {
+  lightBit = lightBits - 1;
+  byte sreg = SREG;
+  cli(); // 16 bit register (TEMP byte, see the interrupt)
+  OCR1B = 0;
+  SREG = sreg;
+  TIFR1 = _BV(OCF1B);
+  TIMSK1 |= _BV(OCIE1B);
+}
+
+// Light pin to output, off
+void lightAttach(byte output) {
+  byte pin = pgm_read_byte(&lightPins[output]);
+  digitalWrite(pin, LOW);
+  pinMode(pin, OUTPUT);
+  lights[output].next = lightOffPattern;
+  lights[output].pattern = lightOffPattern;
+  cli();
+  if (pin >= A0) lightMaskC |= _BV(pin - A0);
+  else lightMaskD |= _BV(pin);
+  lightAttached |= _BV(output);
+  sei();
+}
+
+// Can be called in every loop pass, the pattern only restarts, if it is changed
+void lightPattern(byte output, const lightStep *pattern) {
+  cli(); // 16 bit pointer, read by the interrupt
+  lights[output].next = pattern;
+  sei();
+}
+
+#endif
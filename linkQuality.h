@@ -0,0 +1,97 @@
+#ifndef linkQuality_h
+#define linkQuality_h
+
+#include "Arduino.h"
+
+//
+// =======================================================================================================
+// RADIO LINK QUALITY STATISTICS
+// =======================================================================================================
+//
+
+// Packets per second, missed packets, channel switches and radio re-initialisations are counted and evaluated
+// once per second. The resulting link quality (0 - 100%) is sent back to the transmitter in the ACK payload.
+// - Transmitters with packet sequence number: link quality = received / (received + missed) packets
+// - Older transmitters without sequence number: link quality = packets per second / best packets per second
+// This allows to separate a bad radio link from a slow control loop (packets per second drop without missed packets)
+
+// Counters of the current second
+unsigned int linkPackets;
+unsigned int linkMissed;
+
+// Results of the last second
+byte linkQualityPercent = 100;
+unsigned int linkPacketsPerSecond;
+unsigned int linkMissedPerSecond;
+unsigned int linkPeakPacketsPerSecond;
+
+// Totals since power up
+unsigned int linkChannelSwitches;
+unsigned int linkReinits;
+unsigned int linkBadPackets; // packets with unknown size or format
+
+boolean linkSequenceValid; // the last packet did contain a sequence number
+byte linkLastSequence;
+
+// A packet was received. "hasSequence" = the packet did contain a sequence number. Returns the number of missed packets
+byte linkPacket(boolean hasSequence, byte sequence) {
+  byte missed = 0;
+  if (hasSequence && linkSequenceValid) {
+    byte gap = sequence - linkLastSequence - 1; // number of missed packets in between (8 bit wrap around)
+    if (gap < 128) missed = gap; // bigger gaps are old or repeated packets
+  }
+  linkMissed += missed;
+  linkSequenceValid = hasSequence;
+  linkLastSequence = sequence;
+  linkPackets ++;
+  return missed;
+}
+
+void linkChannelSwitch() {
+  linkChannelSwitches ++;
+}
+
+void linkBadPacket() {
+  linkBadPackets ++;
+}
+
+void linkReinit() {
+  linkReinits ++;
+  linkSequenceValid = false; // the transmitter may have been switched off in the meantime
+}
+
+// Evaluate the counters once per second. Returns true, if a new window was evaluated
+boolean linkUpdate() {
+  if (taskDue(TASK_LINK)) { // every 1000ms (see scheduler.h)
+
+    linkPacketsPerSecond = linkPackets;
+    linkMissedPerSecond = linkMissed;
+    if (linkPackets > linkPeakPacketsPerSecond) linkPeakPacketsPerSecond = linkPackets;
+
+    if (linkPackets == 0) linkQualityPercent = 0;
+    else if (linkMissed > 0 || linkSequenceValid) linkQualityPercent = 100UL * linkPackets / (linkPackets + linkMissed);
+    else linkQualityPercent = 100UL * linkPackets / linkPeakPacketsPerSecond;
+
+    linkPackets = 0;
+    linkMissed = 0;
+
+#ifdef DEBUG
+    Serial.print("Link quality %: ");
+    Serial.print(linkQualityPercent);
+    Serial.print("   packets/s: ");
+    Serial.print(linkPacketsPerSecond);
+    Serial.print("   missed/s: ");
+    Serial.print(linkMissedPerSecond);
+    Serial.print("   channel switches: ");
+    Serial.print(linkChannelSwitches);
+    Serial.print("   re-inits: ");
+    Serial.print(linkReinits);
+    Serial.print("   bad packets: ");
+    Serial.println(linkBadPackets);
+#endif
+    return true;
+  }
+  return false;
+}
+
+#endif
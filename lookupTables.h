@@ -0,0 +1,173 @@
+#ifndef lookupTables_h
+#define lookupTables_h
+
+#include "Arduino.h"
+
+//
+// =======================================================================================================
+// OUTPUT LOOKUP TABLES
+// =======================================================================================================
+//
+
+// All RC axes are in the range of 0 - 100. So the output values for each axis are calculated during compilation
+// and stored in PROGMEM tables with 101 entries. The main loop only has to read them instead of using map() and reMap().
+// The tables depend on the vehicle configuration in "vehicleConfig.h" and on the curves in "steeringCurves.h"
+// Tables, which are not used in the selected configuration are removed by the linker.
+
+// Expands F(0), F(1), ..., F(100) for the table initialisation
+#define LUT_101(F) \
+  F(0), F(1), F(2), F(3), F(4), F(5), F(6), F(7), F(8), F(9), \
+  F(10), F(11), F(12), F(13), F(14), F(15), F(16), F(17), F(18), F(19), \
+  F(20), F(21), F(22), F(23), F(24), F(25), F(26), F(27), F(28), F(29), \
+  F(30), F(31), F(32), F(33), F(34), F(35), F(36), F(37), F(38), F(39), \
+  F(40), F(41), F(42), F(43), F(44), F(45), F(46), F(47), F(48), F(49), \
+  F(50), F(51), F(52), F(53), F(54), F(55), F(56), F(57), F(58), F(59), \
+  F(60), F(61), F(62), F(63), F(64), F(65), F(66), F(67), F(68), F(69), \
+  F(70), F(71), F(72), F(73), F(74), F(75), F(76), F(77), F(78), F(79), \
+  F(80), F(81), F(82), F(83), F(84), F(85), F(86), F(87), F(88), F(89), \
+  F(90), F(91), F(92), F(93), F(94), F(95), F(96), F(97), F(98), F(99), \
+  F(100)
+
+// Same calculation as the Arduino map() function, but usable during compilation
+constexpr long lutMap(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+//
+// =======================================================================================================
+// SERVO PULSE TABLES
+// =======================================================================================================
+//
+
+// The servo limits in "vehicleConfig.h" are in degrees. They are converted to microseconds first, so the tables
+// use the full 1us resolution of the servo engine (see servos.h) instead of 1° steps (about 10us)
+
+// Servo 1 (steering). The MRSC steering angle always uses the linear (2 point) table
+constexpr uint16_t servo1LinearPulse(long i) {
+  return lutMap(i, 100, 0, servoMicroseconds(lim1L), servoMicroseconds(lim1R));
+}
+const uint16_t servo1LinearLut[] PROGMEM = { LUT_101(servo1LinearPulse) };
+
+#ifdef STEERING_3_POINT_CAL
+constexpr uint16_t servo1Pulse(long i) {
+  return i < 50 ? lutMap(i, 50, 0, servoMicroseconds(lim1C), servoMicroseconds(lim1R))
+         : i > 50 ? lutMap(i, 100, 50, servoMicroseconds(lim1L), servoMicroseconds(lim1C)) : servoMicroseconds(lim1C);
+}
+const uint16_t servo1Lut[] PROGMEM = { LUT_101(servo1Pulse) };
+#else
+#define servo1Lut servo1LinearLut // Identical without separate center point
+#endif
+
+// Servo 2 (elevator)
+constexpr uint16_t servo2Pulse(long i) {
+  return lutMap(i, 100, 0, servoMicroseconds(lim2L), servoMicroseconds(lim2R));
+}
+const uint16_t servo2Lut[] PROGMEM = { LUT_101(servo2Pulse) };
+
+// Servo 3 (throttle), full and limited speed
+constexpr uint16_t servo3Pulse(long i) {
+  return lutMap(i, 100, 0, servoMicroseconds(lim3L), servoMicroseconds(lim3R));
+}
+const uint16_t servo3Lut[] PROGMEM = { LUT_101(servo3Pulse) };
+
+constexpr uint16_t servo3LowPulse(long i) {
+  return lutMap(i, 100, 0, servoMicroseconds(lim3Llow), servoMicroseconds(lim3Rlow));
+}
+const uint16_t servo3LowLut[] PROGMEM = { LUT_101(servo3LowPulse) };
+
+// Servo 3 (ESC) in microseconds, including the exponential throttle compensation curve
+constexpr uint16_t escMicroseconds(long i) {
+  return curveValue(curveExponentialThrottlePoints, lutMap(i, 100, 0, 2000, 1000));
+}
+const uint16_t escMicrosecondsLut[] PROGMEM = { LUT_101(escMicroseconds) };
+
+// Servo 4 (rudder) or potentiometer knob
+constexpr uint16_t servo4Pulse(long i) {
+  return lutMap(i, 100, 0, servoMicroseconds(lim4L), servoMicroseconds(lim4R));
+}
+const uint16_t servo4Lut[] PROGMEM = { LUT_101(servo4Pulse) };
+
+constexpr uint16_t potPulse(long i) {
+  return lutMap(i, 0, 100, servoMicroseconds(45), servoMicroseconds(135));
+}
+const uint16_t potLut[] PROGMEM = { LUT_101(potPulse) };
+
+//
+// =======================================================================================================
+// SBUS VALUE TABLE
+// =======================================================================================================
+//
+
+constexpr uint16_t sbusValue(long i) {
+  return lutMap(i, 0, 100, 172, 1811);
+}
+const uint16_t sbusLut[] PROGMEM = { LUT_101(sbusValue) };
+
+//
+// =======================================================================================================
+// STEERING OVERLAY TABLES (for caterpillar and differential thrust vehicles)
+// =======================================================================================================
+//
+
+// The input signal range
+const int servoMin = 5;
+const int servoMax = 95;
+const int servoNeutralMin = 48;
+const int servoNeutralMax = 52;
+
+// Steering signal (data.axis1) to steering factor. 100 = wheel spins with 100% of the requested speed
+constexpr int8_t steeringFactorLeft(long i) {
+  return i <= servoNeutralMin ? constrain(lutMap(i, servoMin, servoNeutralMin, 0, 100), 0, 100) : 100;
+}
+const int8_t steeringFactorLeftLut[] PROGMEM = { LUT_101(steeringFactorLeft) };
+
+constexpr int8_t steeringFactorRight(long i) {
+  return i >= servoNeutralMax ? constrain(lutMap(i, servoMax, servoNeutralMax, 0, 100), 0, 100) : 100;
+}
+const int8_t steeringFactorRightLut[] PROGMEM = { LUT_101(steeringFactorRight) };
+
+// Steering factor to nonlinear steering factor (-100% = wheel spins with 100% of the requested speed backward)
+constexpr int8_t curveSemiValue(long i) {
+  return curveValue(curveSemiPoints, i);
+}
+const int8_t curveSemiLut[] PROGMEM = { LUT_101(curveSemiValue) };
+
+constexpr int8_t curveFullValue(long i) {
+  return curveValue(curveFullPoints, i);
+}
+const int8_t curveFullLut[] PROGMEM = { LUT_101(curveFullValue) };
+
+constexpr int8_t curveThrustValue(long i) {
+  return curveValue(curveThrustPoints, i);
+}
+const int8_t curveThrustLut[] PROGMEM = { LUT_101(curveThrustValue) };
+
+// Throttle signal (data.axis3) to -100 to 100% (slightly more at the end points)
+constexpr int8_t steeringThrottle(long i) {
+  return lutMap(i, servoMin, servoMax, 100, -100);
+}
+const int8_t steeringThrottleLut[] PROGMEM = { LUT_101(steeringThrottle) };
+
+//
+// =======================================================================================================
+// TABLE READ FUNCTIONS
+// =======================================================================================================
+//
+
+// Values above 100 are limited, so a corrupted radio packet can't read outside the table
+byte readLut(const byte *lut, byte index) {
+  if (index > 100) index = 100;
+  return pgm_read_byte(&lut[index]);
+}
+
+int8_t readLut(const int8_t *lut, byte index) {
+  if (index > 100) index = 100;
+  return pgm_read_byte(&lut[index]);
+}
+
+uint16_t readLut(const uint16_t *lut, byte index) {
+  if (index > 100) index = 100;
+  return pgm_read_word(&lut[index]);
+}
+
+#endif
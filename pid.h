@@ -0,0 +1,78 @@
+#ifndef pid_h
+#define pid_h
+
+#include "Arduino.h"
+
+//
+// =======================================================================================================
+// FIXED POINT PID CONTROLLER
+// =======================================================================================================
+//
+
+// Replaces the PID_v1 library (double = float on AVR) for the balancing robot. Same algorithm as PID_v1:
+// - derivative on measurement (no derivative kick, if the setpoint changes)
+// - the integral is limited to the output range (anti windup)
+// Setpoint, input and output are Q16.16 values (x * 65536). The error is used with 1/256 resolution (limited to +/-127),
+// the input change per sample with 1/4096 resolution (limited to +/-7.9), which is sufficient for angles and speeds.
+// Each gain is stored as a 16 bit mantissa with a shift, so a term is a fast 16 x 16 bit multiplication. The gains
+// are converted in pidSetTunings() only, which should be called only if they have changed (not in every loop).
+
+struct pidController {
+  int kp, ki, kd; // gain mantissas (gain = mantissa / 2^shift)
+  int8_t kpShift, kiShift, kdShift;
+  long integral; // Q8.24
+  long lastInput; // Q16.16
+  boolean started; // lastInput is valid (set by the first pidCompute() )
+  long outMin, outMax; // Q16.16
+};
+
+// Convert a gain to mantissa & shift (gain must be < 128)
+void pidGain(float gain, int &mantissa, int8_t &shift) {
+  shift = 8;
+  if (gain > 0) {
+    while (gain * (1L << shift) < 16384 && shift < 30) shift ++; // normalize the mantissa to 16384 - 32767
+  }
+  mantissa = gain * (1L << shift) + 0.5;
+}
+
+// Gains per second, converted to gains per sample (same as PID_v1)
+void pidSetTunings(pidController &pid, float kp, float ki, float kd, unsigned int rate) {
+  pidGain(kp, pid.kp, pid.kpShift);
+  pidGain(ki / rate, pid.ki, pid.kiShift);
+  pidGain(kd * rate, pid.kd, pid.kdShift);
+}
+
+void pidSetOutputLimits(pidController &pid, int outMin, int outMax) {
+  pid.outMin = (long)outMin << 16;
+  pid.outMax = (long)outMax << 16;
+}
+
+// value (Q8) * mantissa / 2^shift
+long pidTerm(int value, int mantissa, int8_t shift) {
+  long term = (long)value * mantissa;
+  return shift >= 0 ? term >> shift : term << -shift;
+}
+
+int pidLimit(long value, byte shift) { // Q16.16 to a rounded 16 bit value
+  return constrain((value + (1L << (shift - 1))) >> shift, -32767L, 32767L);
+}
+
+// Must be called with the rate, which was passed to pidSetTunings() (e.g. with a scheduler task)
+long pidCompute(pidController &pid, long setpoint, long input) {
+  if (!pid.started) { // First sample: no derivative kick (PID_v1 initializes lastInput, if it is switched to AUTOMATIC)
+    pid.lastInput = input;
+    pid.started = true;
+  }
+
+  int error = pidLimit(setpoint - input, 8); // Q8
+  int dInput = pidLimit(input - pid.lastInput, 4); // Q12
+  pid.lastInput = input;
+
+  pid.integral += pidTerm(error, pid.ki, pid.kiShift - 16);
+  pid.integral = constrain(pid.integral, pid.outMin << 8, pid.outMax << 8);
+
+  long output = pidTerm(error, pid.kp, pid.kpShift - 8) + (pid.integral >> 8) - pidTerm(dInput, pid.kd, pid.kdShift - 4);
+  return constrain(output, pid.outMin, pid.outMax);
+}
+
+#endif
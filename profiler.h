@@ -0,0 +1,110 @@
+#ifndef profiler_h
+#define profiler_h
+
+#include "Arduino.h"
+
+//
+// =======================================================================================================
+// CODE REGION PROFILER (if "#define PROFILER" is active in the main sketch)
+// =======================================================================================================
+//
+
+// Frame the code you want to measure with profileBegin(region) and profileEnd(region). The duration is measured with
+// micros() and stored in a ring buffer (the newest "profileBufferSize" samples). Min, max and average are kept
+// for each region. Every 2s the statistics and the ring buffer are printed in DEBUG mode.
+// Without "#define PROFILER" all functions are empty and removed by the compiler.
+
+enum profilerRegion {
+  PROFILE_MPU_READ, // readMpu6050Data(): start of the I2C transfer
+  PROFILE_MPU_PROCESS, // processMpu6050Data()
+  PROFILE_SPEED_PID, // speed pidCompute()
+  PROFILE_ANGLE_PID, // angle pidCompute()
+  PROFILE_STEERING, // steering overlay lookup tables in driveMotorsSteering()
+  PROFILE_REGIONS
+};
+
+#ifdef PROFILER
+const char *const profileNames[PROFILE_REGIONS] = {
+  "MPU-6050 read", "processMpu6050Data", "speed PID", "angle PID", "steering overlay"
+};
+
+const byte profileBufferSize = 32;
+
+struct profileSample {
+  byte region;
+  unsigned int duration; // us
+};
+
+struct profileStats {
+  unsigned long start; // micros() of the last profileBegin()
+  unsigned long sum;
+  unsigned int count;
+  unsigned int min;
+  unsigned int max;
+};
+
+profileSample profileBuffer[profileBufferSize];
+byte profileBufferIndex; // next write position
+profileStats profile[PROFILE_REGIONS];
+
+void profileBegin(byte region) {
+  profile[region].start = micros();
+}
+
+void profileEnd(byte region) {
+  unsigned int duration = micros() - profile[region].start;
+  profileStats &stats = profile[region];
+
+  if (stats.count == 0 || duration < stats.min) stats.min = duration;
+  if (duration > stats.max) stats.max = duration;
+  stats.sum += duration;
+  stats.count ++;
+
+  profileBuffer[profileBufferIndex].region = region;
+  profileBuffer[profileBufferIndex].duration = duration;
+  profileBufferIndex ++;
+  if (profileBufferIndex >= profileBufferSize) profileBufferIndex = 0;
+}
+
+void profileReport() {
+  static unsigned long lastReport;
+  if (millis() - lastReport >= 2000) {
+    lastReport = millis();
+#ifdef DEBUG
+    for (byte i = 0; i < PROFILE_REGIONS; i++) {
+      if (profile[i].count == 0) continue;
+      Serial.print(profileNames[i]);
+      Serial.print("   n: ");
+      Serial.print(profile[i].count);
+      Serial.print("   min us: ");
+      Serial.print(profile[i].min);
+      Serial.print("   avg us: ");
+      Serial.print(profile[i].sum / profile[i].count);
+      Serial.print("   max us: ");
+      Serial.println(profile[i].max);
+    }
+    Serial.print("Last samples (region:us): ");
+    for (byte i = 0; i < profileBufferSize; i++) { // oldest first
+      profileSample &sample = profileBuffer[(profileBufferIndex + i) % profileBufferSize];
+      Serial.print(sample.region);
+      Serial.print(":");
+      Serial.print(sample.duration);
+      Serial.print(" ");
+    }
+    Serial.println();
+#endif
+    for (byte i = 0; i < PROFILE_REGIONS; i++) {
+      profile[i].sum = 0;
+      profile[i].count = 0;
+      profile[i].min = 0;
+      profile[i].max = 0;
+    }
+  }
+}
+#else // Empty functions, if the profiler is disabled
+void profileBegin(byte) {}
+void profileEnd(byte) {}
+void profileReport() {}
+#endif
+
+#endif
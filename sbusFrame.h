@@ -0,0 +1,45 @@
+#ifndef sbusFrame_h
+#define sbusFrame_h
+
+#include "Arduino.h"
+
+//
+// =======================================================================================================
+// SBUS FRAME ENCODER
+// =======================================================================================================
+//
+
+// Replaces the SBUS library, which packs all 16 channels bit by bit into a new frame for every write(). Here, the
+// 25 byte frame stays in memory and sbusSetChannel() only packs a channel, if its value has changed. Most channels
+// (switches, unused channels) never change, so usually only a few channels are packed per frame.
+// The frame is sent by the interrupt driven UART transmitter (see uart.h), 100000 baud, 8E2 (inverted by the receiver).
+// Frame: 0x0F, 16 channels x 11 bit (LSB first), flags, 0x00
+
+const byte sbusFrameLength = 25;
+const uint16_t sbusLow = 172; // Switch off, axis min.
+const uint16_t sbusHigh = 1811; // Switch on, axis max.
+const uint16_t sbusNeutral = 991; // Unused channels
+
+byte sbusFrame[sbusFrameLength] = {0x0F}; // Channel data, flags and footer are 0
+uint16_t sbusValues[16]; // Packed values, all 0 like the channel data at the beginning
+
+void sbusSetChannel(byte channel, uint16_t value) {
+  if (value == sbusValues[channel]) return;
+  sbusValues[channel] = value;
+
+  unsigned int bitIndex = channel * 11;
+  byte *data = &sbusFrame[1 + (bitIndex >> 3)];
+  byte shift = bitIndex & 7;
+  uint32_t mask = 0x7FFUL << shift;
+  uint32_t bits = (uint32_t)(value & 0x7FF) << shift;
+
+  data[0] = (data[0] & ~(byte)mask) | (byte)bits;
+  data[1] = (data[1] & ~(byte)(mask >> 8)) | (byte)(bits >> 8);
+  if (shift > 5) data[2] = (data[2] & ~(byte)(mask >> 16)) | (byte)(bits >> 16); // 11 bits spread over 3 bytes
+}
+
+uint16_t sbusSwitch(boolean on) {
+  return on ? sbusHigh : sbusLow;
+}
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef scheduler_h
+#define scheduler_h
+
+#include "Arduino.h"
+
+//
+// =======================================================================================================
+// COOPERATIVE TASK SCHEDULER
+// =======================================================================================================
+//
+
+// The periodic functions don't use their own "millis() - lastX >= N" timers anymore. Instead, schedulerUpdate()
+// releases them at the beginning of each loop() pass and the functions check taskDue().
+// - The release times are calculated from the previous release time (not from the current time), so the
+//   timing stays deterministic, even if the loop is a bit late
+// - The phase offsets make sure, that the tasks are not released at the same time
+// - Critical tasks (IMU, PID) are always released first. Only one non critical task is released per loop pass and
+//   none at all, if a critical task is released in the same pass. Delayed tasks are released in the next passes.
+// - If a task is released later than its deadline, its overrun counter is incremented. The counters are printed
+//   every 2s in DEBUG mode
+
+// Balancing robot (vehicleType 4) control rates in Hz: 125, 250 or 500
+// Use "#define MPU6050_FIFO" for more than 125Hz, because the loop time may be longer than one sensor period
+const unsigned int imuRate = 125; // MPU-6050 reading & angle calculation (TASK_IMU)
+const unsigned int anglePidRate = 125; // Angle PID (inner, fast control loop), not faster than imuRate
+const unsigned int speedPidRate = 125; // Speed PID (outer, slow control loop)
+
+constexpr boolean validControlRate(unsigned int rate) {
+  return rate == 125 || rate == 250 || rate == 500;
+}
+static_assert(validControlRate(imuRate) && validControlRate(anglePidRate) && validControlRate(speedPidRate),
+              "imuRate, anglePidRate and speedPidRate must be 125, 250 or 500Hz");
+static_assert(anglePidRate <= imuRate, "anglePidRate must not be faster than imuRate");
+
+enum schedulerTaskId { // The order is the priority
+  TASK_IMU, // MPU-6050 reading & processing
+  TASK_SPEED_PID, // balancing robot speed PID
+  TASK_ANGLE_PID, // balancing robot angle PID
+  TASK_SERIAL, // SBUS or serial commands to the light & sound controller
+  TASK_SPEED_POT, // balancing robot speed pot fader
+  TASK_LINK, // link quality statistics
+  TASK_BATTERY, // battery & vcc measurement
+  TASK_COUNT
+};
+
+struct schedulerTask {
+  unsigned long period; // us
+  unsigned long offset; // us, phase offset of the first release
+  unsigned long deadline; // us, max. release delay before an overrun is counted
+  boolean critical; // always released in time, blocks non critical tasks in the same pass
+};
+
+const schedulerTask taskTable[TASK_COUNT] PROGMEM = {
+  // period, offset, deadline, critical
+  {1000000UL / imuRate, 0, 1000, true}, // TASK_IMU: 125Hz = 8000us
+  {1000000UL / speedPidRate, 2000, 1000, true}, // TASK_SPEED_PID
+  {1000000UL / anglePidRate, 2000, 1000, true}, // TASK_ANGLE_PID
+#ifdef SBUS_SERIAL
+#ifdef SBUS_HIGH_SPEED
+  {7000, 1000, 3500, false}, // TASK_SERIAL: high speed SBUS every 7ms
+#else
+  {14000, 1000, 7000, false}, // TASK_SERIAL: SBUS every 14ms
+#endif
+#elif defined BINARY_SERIAL
+  {10000, 1000, 5000, false}, // TASK_SERIAL: binary frames every 10ms (100Hz)
+#else
+  {20000, 1000, 10000, false}, // TASK_SERIAL: serial commands every 20ms
+#endif
+  {40000, 3000, 20000, false}, // TASK_SPEED_POT
+  {1000000, 5000, 100000, false}, // TASK_LINK
+  {1000000, 6000, 100000, false}, // TASK_BATTERY
+};
+
+unsigned long taskNextRelease[TASK_COUNT];
+unsigned int taskOverruns[TASK_COUNT];
+unsigned int taskReleased; // bit mask of the tasks, which are due in the current loop pass
+
+void setupScheduler() {
+  unsigned long now = micros();
+  for (byte i = 0; i < TASK_COUNT; i++) {
+    taskNextRelease[i] = now + pgm_read_dword(&taskTable[i].offset);
+  }
+}
+
+void schedulerUpdate() {
+  unsigned long now = micros();
+  boolean blocked = false; // a task was already released in this pass
+
+  taskReleased = 0;
+  for (byte i = 0; i < TASK_COUNT; i++) {
+    boolean critical = pgm_read_byte(&taskTable[i].critical);
+    long late = now - taskNextRelease[i];
+    if (late < 0 || (blocked && !critical)) continue; // not due or delayed to the next pass
+
+    unsigned long period = pgm_read_dword(&taskTable[i].period);
+    if ((unsigned long)late > pgm_read_dword(&taskTable[i].deadline)) taskOverruns[i] ++;
+    taskNextRelease[i] += period;
+    if ((unsigned long)late >= period) taskNextRelease[i] = now + period; // more than one period late: skip the missed releases
+
+    taskReleased |= 1 << i;
+    blocked = true;
+  }
+}
+
+boolean taskDue(byte task) {
+  return taskReleased & (1 << task);
+}
+
+// Overrun counters since power up
+void schedulerReport() {
+#ifdef DEBUG
+  static const char *const taskNames[TASK_COUNT] = {
+    "IMU", "speed PID", "angle PID", "serial", "speed pot", "link", "battery"
+  };
+  static unsigned long lastReport;
+  if (millis() - lastReport >= 2000) {
+    lastReport = millis();
+    Serial.print("Task overruns:");
+    for (byte i = 0; i < TASK_COUNT; i++) {
+      Serial.print("   ");
+      Serial.print(taskNames[i]);
+      Serial.print(": ");
+      Serial.print(taskOverruns[i]);
+    }
+    Serial.println();
+  }
+#endif
+}
+
+#endif
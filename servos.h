@@ -0,0 +1,183 @@
+#ifndef servos_h
+#define servos_h
+
+#include "Arduino.h"
+
+//
+// =======================================================================================================
+// TIMER 1 SERVO PULSE ENGINE
+// =======================================================================================================
+//
+
+// Replaces the Servo library for the 4 servo outputs A0 - A3 (PORTC bit 0 - 3). The Servo library generates the
+// pulses one after the other and converts the angle with map() in each write() call. Here:
+// - Timer 1 runs in CTC mode with ICR1 as TOP. The capture interrupt (TOP = frame start) sets all attached pins high,
+//   the compare A interrupt clears them at their sorted, precomputed pulse end tick values. The pulses are generated
+//   in parallel, so the frame can be as short as 3ms (333Hz digital servos)
+// - A0 - A3 are no OC1x pins, so the pins are written directly by the interrupts (PORTC, no digitalWrite())
+// - servoWrite() & servoWriteMicroseconds() only store the tick values. servoUpdate() sorts them into the back
+//   buffer and the frame interrupt swaps the buffers at the next frame start. So all channels are always updated
+//   together and never in the middle of a pulse
+// - The pulse width resolution is 1us (1 tick @ 8MHz, 2 ticks @ 16MHz) on all channels
+
+const unsigned int servoFrameRate = 50; // Hz: 50 (analog servos & ESC), 100 or 333 (digital servos only!)
+
+const uint16_t servoMinUs = 544; // Same pulse range as the Servo library
+const uint16_t servoMaxUs = 2400;
+
+const uint16_t servoTicksPerUs = F_CPU / 8000000UL; // Prescaler 8
+const uint16_t servoFrameTicks = 1000000UL / servoFrameRate * servoTicksPerUs;
+
+static_assert(servoFrameTicks > (servoMaxUs + 100) * servoTicksPerUs, "servoFrameRate too high for the max. pulse width");
+
+enum servoChannels { // A0 - A3
+  SERVO1,
+  SERVO2,
+  SERVO3,
+  SERVO4,
+  SERVO_COUNT
+};
+
+// Same conversion as Servo.write(), usable during compilation
+constexpr uint16_t servoMicroseconds(long degrees) {
+  return servoMinUs + degrees * (servoMaxUs - servoMinUs) / 180;
+}
+
+struct servoEvent {
+  uint16_t ticks; // pulse end
+  byte mask; // PORTC pins, which are cleared at this time
+};
+
+// Double buffer, each with up to 4 sorted events and an end marker, which is never reached (beyond TOP)
+servoEvent servoEvents[2][SERVO_COUNT + 1];
+byte servoStartMask[2]; // PORTC pins, which are set at the frame start
+volatile byte servoFront; // Buffer, which is used by the interrupts
+volatile boolean servoPending; // Back buffer is ready, swap it at the next frame start
+const servoEvent *servoNextEvent;
+
+uint16_t servoTicks[SERVO_COUNT]; // Written by the main loop
+byte servoAttached; // PORTC pin mask
+boolean servoChanged;
+
+//
+// =======================================================================================================
+// TIMER 1 INTERRUPTS
+// =======================================================================================================
+//
+
+ISR(TIMER1_CAPT_vect) { // Frame start
+  if (servoPending) {
+    servoFront ^= 1;
+    servoPending = false;
+  }
+  PORTC |= servoStartMask[servoFront];
+  servoNextEvent = servoEvents[servoFront];
+  OCR1A = servoNextEvent->ticks;
+}
+
+ISR(TIMER1_COMPA_vect) { // Pulse end
+  const servoEvent *event = servoNextEvent;
+  do { // Also ends the next pulses, if they are too close for a new compare match
+    PORTC &= ~event->mask;
+    event++;
+  } while (event->ticks <= TCNT1 + 4 * servoTicksPerUs);
+  OCR1A = event->ticks;
+  servoNextEvent = event;
+}
+
+//
+// =======================================================================================================
+// SETUP, ATTACH & DETACH
+// =======================================================================================================
+//
+
+void setupServos() {
+  for (byte i = 0; i < 2; i++) {
+    servoEvents[i][0].ticks = 0xFFFF; // Empty buffers, no pulses
+    servoEvents[i][0].mask = 0;
+    servoStartMask[i] = 0;
+  }
+  for (byte i = 0; i < SERVO_COUNT; i++) servoTicks[i] = 1500 * servoTicksPerUs; // Neutral
+
+  TCCR1A = 0;                                                          // Mode 12: CTC, TOP = ICR1
+  TCCR1B = _BV(WGM13) | _BV(WGM12) | _BV(CS11);                        // Prescaler 8
+  ICR1 = servoFrameTicks - 1;
+  OCR1A = 0xFFFF;
+  TCNT1 = 0;
+  TIFR1 = _BV(ICF1) | _BV(OCF1A);                                      // Clear pending interrupts
+  TIMSK1 = _BV(ICIE1) | _BV(OCIE1A);
+}
+
+// Channel 0 - 3 = pin A0 - A3. Takes effect with the next servoUpdate()
+void servoAttach(byte channel) {
+  if (servoAttached & _BV(channel)) return;
+  digitalWrite(A0 + channel, LOW);
+  pinMode(A0 + channel, OUTPUT);
+  servoAttached |= _BV(channel);
+  servoChanged = true;
+}
+
+// The pin stays low after the current pulse
+void servoDetach(byte channel) {
+  if (!(servoAttached & _BV(channel))) return;
+  servoAttached &= ~_BV(channel);
+  servoChanged = true;
+}
+
+//
+// =======================================================================================================
+// WRITE & UPDATE
+// =======================================================================================================
+//
+
+void servoWriteMicroseconds(byte channel, uint16_t us) {
+  uint16_t ticks = constrain(us, servoMinUs, servoMaxUs) * servoTicksPerUs;
+  if (servoTicks[channel] != ticks) {
+    servoTicks[channel] = ticks;
+    servoChanged = true;
+  }
+}
+
+void servoWrite(byte channel, byte degrees) {
+  servoWriteMicroseconds(channel, servoMicroseconds(degrees));
+}
+
+// Sort the pulse ends of all attached channels into the back buffer and hand it to the frame interrupt
+void servoUpdate() {
+  if (!servoChanged) return;
+  servoChanged = false;
+
+  servoPending = false; // The frame interrupt must not swap the buffers, while the back buffer is written
+  byte back = servoFront ^ 1;
+  servoEvent *events = servoEvents[back];
+  byte count = 0;
+
+  for (byte channel = 0; channel < SERVO_COUNT; channel++) {
+    if (!(servoAttached & _BV(channel))) continue;
+    uint16_t ticks = servoTicks[channel];
+    byte i = 0;
+    while (i < count && events[i].ticks < ticks) i++;
+    if (i < count && events[i].ticks == ticks) events[i].mask |= _BV(channel); // Same pulse end
+    else {
+      for (byte j = count; j > i; j--) events[j] = events[j - 1];
+      events[i].ticks = ticks;
+      events[i].mask = _BV(channel);
+      count++;
+    }
+  }
+  events[count].ticks = 0xFFFF; // End marker
+  events[count].mask = 0;
+  servoStartMask[back] = servoAttached;
+
+  servoPending = true;
+}
+
+// Time in us until the next frame start, where the pulses of the last servoUpdate() begin
+uint16_t servoFrameDelay() {
+  cli(); // 16 bit timer register
+  uint16_t ticks = TCNT1;
+  sei();
+  return (servoFrameTicks - ticks) / servoTicksPerUs;
+}
+
+#endif
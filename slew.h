@@ -0,0 +1,126 @@
+#ifndef slew_h
+#define slew_h
+
+#include "Arduino.h"
+
+//
+// =======================================================================================================
+// TIME BASED SLEW RATE GENERATOR (THROTTLE RAMPS)
+// =======================================================================================================
+//
+
+// Replaces the loop based ramps (1 step per call, if at least N ms have passed), which are too slow, if the loop
+// takes longer than the step time. slewUpdate() calculates the new position from the elapsed time in 1ms steps
+// (the remaining us are kept for the next call), so the ramp speed doesn't depend on the loop time.
+// - Separate rates for accelerating (away from neutral) and braking (towards neutral or through neutral)
+// - Optional S-curve: the slew rate itself ramps up and down within "curveTime", so the target is approached smoothly
+// Positions are Q16.16 values in the units of the output (e.g. us for an ESC, 0 - 100 for the TB6612FNG motors).
+// "braking" is true, while the ramp moves towards neutral (used for the brake lights).
+
+const byte slewMaxSteps = 100; // ms, max. time, which is caught up after a very long loop pass
+
+struct slewProfile {
+  long accelerationStep; // Q16.16 units per ms, away from neutral, 0 = no limit
+  long brakeStep; // Q16.16 units per ms, towards neutral, 0 = no limit
+  unsigned int curveTime; // ms until the full slew rate is reached (S-curve), 0 = linear ramp
+};
+
+struct slewRamp {
+  long position; // Q16.16
+  long velocity; // Q16.16 units per ms (S-curve only)
+  unsigned long lastTime; // us
+  boolean braking; // Moving towards neutral
+};
+
+// Slew rate in units per second to Q16.16 units per ms
+constexpr long slewStep(unsigned long unitsPerSecond) {
+  return (unitsPerSecond << 16) / 1000;
+}
+
+// Old style ramp time in ms per unit to Q16.16 units per ms (0 = no ramp)
+constexpr long slewStepTime(byte msPerUnit) {
+  return msPerUnit ? 65536L / msPerUnit : 0;
+}
+
+//
+// =======================================================================================================
+// SLEW PROFILES
+// =======================================================================================================
+//
+
+// ESC (ESC_MICROSECONDS option): 1us per ms, same as the old ramp. Example for a smoother start with a faster brake:
+// {slewStep(1000), slewStep(3000), 150}
+const slewProfile escSlewProfile = {slewStep(1000), slewStep(1000), 0};
+
+// TB6612FNG driving motor (maxAcceleration is in ms per 1 step input signal change, see vehicleConfig.h)
+CONFIG_CONST slewProfile motorSlewFull = {slewStepTime(maxAccelerationFull), slewStepTime(maxAccelerationFull), 0};
+CONFIG_CONST slewProfile motorSlewLimited = {slewStepTime(maxAccelerationLimited), slewStepTime(maxAccelerationLimited), 0};
+
+//
+// =======================================================================================================
+// RAMP CALCULATION
+// =======================================================================================================
+//
+
+void slewReset(slewRamp &ramp, int value) {
+  ramp.position = (long)value << 16;
+  ramp.velocity = 0;
+  ramp.lastTime = micros();
+  ramp.braking = false;
+}
+
+// Move the ramp towards "target" and return the new (rounded) position
+int slewUpdate(slewRamp &ramp, int target, int neutral, const slewProfile &profile) {
+  unsigned long now = micros();
+  unsigned long steps = (now - ramp.lastTime) / 1000;
+  if (steps > slewMaxSteps) {
+    steps = slewMaxSteps;
+    ramp.lastTime = now;
+  }
+  else ramp.lastTime += steps * 1000;
+
+  long targetFx = (long)target << 16;
+  long neutralFx = (long)neutral << 16;
+
+  for (; steps > 0; steps--) {
+    long error = targetFx - ramp.position;
+    if (error == 0) {
+      ramp.velocity = 0;
+      ramp.braking = false;
+      break;
+    }
+
+    ramp.braking = ramp.position > neutralFx ? error < 0 : ramp.position < neutralFx && error > 0;
+    long maxStep = ramp.braking ? profile.brakeStep : profile.accelerationStep;
+    if (maxStep == 0) { // No limit
+      ramp.position = targetFx;
+      ramp.velocity = 0;
+      ramp.braking = false;
+      break;
+    }
+
+    long distance = abs(error);
+    long velocity = error > 0 ? maxStep : -maxStep;
+
+    if (profile.curveTime) { // S-curve: limit the velocity change per ms
+      long velocityStep = max(maxStep / profile.curveTime, 1L);
+      long speed = abs(ramp.velocity);
+      if ((ramp.velocity > 0) == (error > 0) && speed / velocityStep * speed / 2 >= distance) velocity = 0; // Slow down in time
+      if (ramp.velocity < velocity) velocity = min(ramp.velocity + velocityStep, velocity);
+      else velocity = max(ramp.velocity - velocityStep, velocity);
+    }
+
+    if ((velocity > 0) == (error > 0) && abs(velocity) >= distance) { // Target reached
+      ramp.position = targetFx;
+      ramp.velocity = 0;
+      ramp.braking = false;
+      break;
+    }
+    ramp.position += velocity;
+    ramp.velocity = velocity;
+  }
+
+  return (ramp.position + 32768) >> 16;
+}
+
+#endif
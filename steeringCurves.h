@@ -13,7 +13,7 @@
 
 // This array is intended for the "Semi caterpillar" mode. The inner wheel can max. slow down to 60% of the
 // outer wheels RPM
-float curveSemi[][2] = {  // see excel sheet!
+constexpr int16_t curveSemiPoints[][2] = {  // see excel sheet!
   {0, 60} // {input value, output value}
   , {25, 70}
   , {50, 80}
@@ -23,7 +23,7 @@ float curveSemi[][2] = {  // see excel sheet!
 
 // This array is intended for the "Caterpillar" mode. The inner wheel can spin backwars  up to 100% of the
 // outer wheels RPM. That allows for turning the vehicle "in place"
-float curveFull[][2] = {
+constexpr int16_t curveFullPoints[][2] = {
   {0, -100} // {input value, output value}
   , {25, 9}
   , {50, 61}
@@ -33,7 +33,7 @@ float curveFull[][2] = {
 
 // This array is intended for the "Forklift2" mode. The inner wheel can spin backwars  up to 100% of the
 // outer wheels RPM. That allows for turning the vehicle "in place"
-float curveForklift2[][2] = { // see excel sheet!
+constexpr int16_t curveForklift2Points[][2] = { // see excel sheet!
   {0, -100} // {input value, output value}
   , {6, -70}
   , {11, -45}
@@ -51,7 +51,7 @@ float curveForklift2[][2] = { // see excel sheet!
 
 // This array is intended for the "Differential Thrust" mode. The inner motor can max. slow down to 20% of the
 // outer motors RPM
-float curveThrust[][2] = {  // see excel sheet!
+constexpr int16_t curveThrustPoints[][2] = {  // see excel sheet!
   {0, 20} // {input value, output value}
   , {25, 40}
   , {50, 60}
@@ -65,7 +65,7 @@ float curveThrust[][2] = {  // see excel sheet!
 // =======================================================================================================
 //
 
-float curveExponentialThrottle[][2] = {
+constexpr int16_t curveExponentialThrottlePoints[][2] = {
     {0, 0} // {input value, output value}
     , {1000, 1000}
     , {1100, 1150}
@@ -90,20 +90,17 @@ float curveExponentialThrottle[][2] = {
 //
 
 // Credit: http://interface.khm.de/index.php/lab/interfaces-advanced/nonlinear-mapping/
+// The curves are only evaluated during compilation: the lookup tables in "lookupTables.h" are generated with
+// curveValue(), so no float math is left at runtime. The integer division truncates towards zero, like the float to
+// int conversion of the former reMap(). Input values outside the curve are limited to the first or last point.
+// The number of points is taken from the array size, so the curves can have any length.
 
-int reMap(float pts[][2], int input) {
-  int rr;
-  float bb, mm;
-
-  for (int nn = 0; nn < 13; nn++) { // was 5
-    if (input >= pts[nn][0] && input <= pts[nn + 1][0]) {
-      mm = ( pts[nn][1] - pts[nn + 1][1] ) / ( pts[nn][0] - pts[nn + 1][0] );
-      mm = mm * (input - pts[nn][0]);
-      mm = mm +  pts[nn][1];
-      rr = mm;
-    }
-  }
-  return (rr);
+template <byte N> constexpr int curveValue(const int16_t (&pts)[N][2], long input, byte i = 0) {
+  return input < pts[0][0] ? pts[0][1] : // below the first point
+         i + 1 >= N ? pts[N - 1][1] : // last point or above
+         input < pts[i + 1][0] ?
+         ((long)pts[i][1] * (pts[i + 1][0] - pts[i][0]) + (long)(pts[i + 1][1] - pts[i][1]) * (input - pts[i][0])) / (pts[i + 1][0] - pts[i][0]) :
+         curveValue(pts, input, i + 1);
 }
 
 #endif
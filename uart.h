@@ -0,0 +1,59 @@
+#ifndef uart_h
+#define uart_h
+
+#include "Arduino.h"
+
+//
+// =======================================================================================================
+// INTERRUPT DRIVEN UART TRANSMITTER
+// =======================================================================================================
+//
+
+// Sends a complete frame from the UART data register empty interrupt. The frame is not copied: it must not be changed,
+// while uartBusy() is true. The interrupt vector is also used by the Arduino HardwareSerial, so this transmitter is
+// only compiled, if "Serial" is not used at all (no DEBUG, SBUS or binary frame mode).
+// Use "#ifdef UART_TX_INTERRUPT" around its use.
+
+#if !defined DEBUG && (defined SBUS_SERIAL || defined BINARY_SERIAL)
+#define UART_TX_INTERRUPT
+#endif
+
+#ifdef UART_TX_INTERRUPT
+
+const byte UART_8N1 = _BV(UCSZ01) | _BV(UCSZ00);
+const byte UART_8E2 = _BV(UPM01) | _BV(USBS0) | _BV(UCSZ01) | _BV(UCSZ00); // SBUS
+
+const byte *uartTxFrame;
+byte uartTxLength;
+volatile byte uartTxIndex;
+
+void setupUart(unsigned long baud, byte format) {
+  UCSR0B = 0;
+  UCSR0A = _BV(U2X0);                                                  // Double speed (same as HardwareSerial)
+  UBRR0 = (F_CPU / 8 + baud / 2) / baud - 1;
+  UCSR0C = format;
+  UCSR0B = _BV(TXEN0);                                                 // Transmitter only, the interrupt is enabled with each frame
+}
+
+ISR(USART_UDRE_vect) {
+  UDR0 = uartTxFrame[uartTxIndex++];
+  if (uartTxIndex >= uartTxLength) UCSR0B &= ~_BV(UDRIE0);             // Last byte is in the transmit buffer
+}
+
+boolean uartBusy() {
+  return uartTxIndex < uartTxLength;
+}
+
+// Start sending a frame, returns false, if the previous frame is still being sent
+boolean uartSend(const byte *frame, byte length) {
+  if (uartBusy()) return false;
+  uartTxFrame = frame;
+  uartTxLength = length;
+  uartTxIndex = 0;
+  UCSR0B |= _BV(UDRIE0);
+  return true;
+}
+
+#endif
+
+#endif